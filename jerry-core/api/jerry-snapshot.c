@@ -984,7 +984,7 @@ jerry_exec_snapshot (const uint32_t *snapshot_p, /**< snapshot */
 
     if (user_value != ECMA_VALUE_EMPTY)
     {
-      CBC_SCRIPT_GET_USER_VALUE (script_p) = ecma_copy_value_if_not_object (user_value);
+      CBC_SCRIPT_GET_USER_VALUE (script_p) = ecma_copy_value_if_not_object (NULL, user_value);
     }
   }
 
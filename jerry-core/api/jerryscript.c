@@ -319,6 +319,20 @@ jerry_heap_gc (jerry_gc_mode_t mode) /**< operational mode */
   ecma_free_unused_memory (JMEM_PRESSURE_HIGH);
 } /* jerry_heap_gc */
 
+/**
+ * Perform a bounded step of incremental garbage collection
+ *
+ * @return true - if the garbage collection cycle is completed by this step
+ *         false - otherwise
+ */
+bool
+jerry_heap_gc_step (uint32_t budget) /**< maximum number of objects visited or freed by the step */
+{
+  jerry_assert_api_enabled ();
+
+  return ecma_gc_incremental_step (budget);
+} /* jerry_heap_gc_step */
+
 /**
  * Get heap memory stats.
  *
@@ -3615,6 +3629,7 @@ jerry_object_set_internal (jerry_value_t object, /**< object value */
     }
 
     value_p->value = ecma_make_object_value (internal_object_p);
+    ecma_gc_write_barrier (obj_p, internal_object_p);
     ecma_deref_object (internal_object_p);
   }
   else
@@ -3632,7 +3647,7 @@ jerry_object_set_internal (jerry_value_t object, /**< object value */
                                                                       ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                                       NULL);
 
-    value_p->value = ecma_copy_value_if_not_object (value);
+    value_p->value = ecma_copy_value_if_not_object (internal_object_p, value);
   }
   else
   {
@@ -4169,6 +4184,11 @@ jerry_foreach_live_object (jerry_foreach_live_object_cb_t callback, /**< functio
 
   JERRY_ASSERT (callback != NULL);
 
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL)
+  {
+    ecma_gc_incremental_cancel ();
+  }
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -4206,6 +4226,11 @@ jerry_foreach_live_object_with_info (const jerry_object_native_info_t *native_in
 
   ecma_native_pointer_t *native_pointer_p;
 
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL)
+  {
+    ecma_gc_incremental_cancel ();
+  }
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -4420,7 +4445,7 @@ jerry_native_ptr_set (jerry_value_t *reference_p, /**< a valid non-NULL pointer
     return;
   }
 
-  *reference_p = ecma_copy_value_if_not_object (value);
+  *reference_p = ecma_copy_value_if_not_object (NULL, value);
 } /* jerry_native_ptr_set */
 
 /**
@@ -5898,6 +5923,8 @@ jerry_realm_set_this (jerry_value_t realm, /**< realm value */
       ECMA_SET_NON_NULL_POINTER (global_object_p->global_env_cp, global_lex_env_p);
       global_object_p->global_scope_cp = global_object_p->global_env_cp;
 
+      ecma_gc_write_barrier_value (object_p, this_value);
+      ecma_gc_write_barrier (object_p, global_lex_env_p);
       ecma_deref_object (global_lex_env_p);
       return ECMA_VALUE_TRUE;
     }
@@ -7089,6 +7116,12 @@ jerry_container_to_array (const jerry_value_t value, /**< the container or itera
 
   ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) obj_p;
 
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_SWEEP)
+  {
+    /* Weak containers may still refer to the objects which are going to be freed. */
+    ecma_gc_incremental_cancel ();
+  }
+
   uint32_t entry_count;
   uint8_t entry_size;
 
@@ -7154,12 +7187,12 @@ jerry_container_to_array (const jerry_value_t value, /**< the container or itera
 
     if (iterator_kind != ECMA_ITERATOR_VALUES)
     {
-      ecma_collection_push_back (collection_buffer, ecma_copy_value_if_not_object (entry_p[0]));
+      ecma_collection_push_back (collection_buffer, ecma_copy_value_if_not_object (NULL, entry_p[0]));
     }
 
     if (iterator_kind != ECMA_ITERATOR_KEYS)
     {
-      ecma_collection_push_back (collection_buffer, ecma_copy_value_if_not_object (entry_p[1]));
+      ecma_collection_push_back (collection_buffer, ecma_copy_value_if_not_object (NULL, entry_p[1]));
     }
   }
   return ecma_op_new_array_object_from_collection (collection_buffer, false);
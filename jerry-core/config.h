@@ -215,6 +215,19 @@
 #define JERRY_GC_MARK_LIMIT (8)
 #endif /* !defined (JERRY_GC_MARK_LIMIT) */
 
+/**
+ * Enable/Disable the generational mode of the garbage collector.
+ *
+ * Allowed values:
+ *  0: Disable generational garbage collection.
+ *  1: Enable generational garbage collection.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_GC_GENERATIONAL
+#define JERRY_GC_GENERATIONAL 0
+#endif /* !defined (JERRY_GC_GENERATIONAL) */
+
 /**
  * Enable/Disable property lookup cache.
  *
@@ -228,6 +241,19 @@
 #define JERRY_LCACHE 1
 #endif /* !defined (JERRY_LCACHE) */
 
+/**
+ * Enable/Disable the inline cache of the property access byte codes.
+ *
+ * Allowed values:
+ *  0: Disable inline cache.
+ *  1: Enable inline cache.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_VM_INLINE_CACHE
+#define JERRY_VM_INLINE_CACHE 1
+#endif /* !defined (JERRY_VM_INLINE_CACHE) */
+
 /**
  * Enable/Disable function toString operation.
  *
@@ -295,6 +321,23 @@
 #define JERRY_MEM_STATS 0
 #endif /* !defined (JERRY_MEM_STATS) */
 
+/**
+ * Maximum size of the memory blocks which are served from segregated free lists.
+ *
+ * Freed blocks up to this size are kept on free lists of their size class (one class
+ * per 8 bytes), so allocating and freeing them takes constant time instead of walking
+ * the address ordered free list of the heap. The free lists are returned to the heap
+ * when the engine runs under high memory pressure. The option has no effect when
+ * JERRY_SYSTEM_ALLOCATOR is enabled.
+ *
+ * Allowed values: multiples of 8 from 8 (16 when JERRY_CPOINTER_32_BIT is enabled) to 128
+ *
+ * Default value: 32
+ */
+#ifndef JERRY_MEM_POOL_MAX_CHUNK_SIZE
+#define JERRY_MEM_POOL_MAX_CHUNK_SIZE 32
+#endif /* !defined (JERRY_MEM_POOL_MAX_CHUNK_SIZE) */
+
 /**
  * Use 32-bit/64-bit float for ecma-numbers
  * This option is for expert use only!
@@ -462,6 +505,19 @@
 #define JERRY_VM_THROW 0
 #endif /* !defined (JERRY_VM_THROW) */
 
+/**
+ * Enable/Disable the direct threaded dispatch of the byte code interpreter.
+ *
+ * Requires a compiler which supports computed gotos (labels as values), e.g. GCC or Clang.
+ *
+ * Allowed values:
+ *  0: Dispatch the byte codes with a switch statement.
+ *  1: Dispatch the byte codes with computed gotos.
+ */
+#ifndef JERRY_VM_COMPUTED_GOTO
+#define JERRY_VM_COMPUTED_GOTO 0
+#endif /* !defined (JERRY_VM_COMPUTED_GOTO) */
+
 /**
  * Advanced section configurations.
  */
@@ -601,9 +657,15 @@
 #if JERRY_GC_MARK_LIMIT < 0
 #error "Invalid value for 'JERRY_GC_MARK_LIMIT' macro."
 #endif /* JERRY_GC_MARK_LIMIT < 0 */
+#if (JERRY_GC_GENERATIONAL != 0) && (JERRY_GC_GENERATIONAL != 1)
+#error "Invalid value for 'JERRY_GC_GENERATIONAL' macro."
+#endif /* (JERRY_GC_GENERATIONAL != 0) && (JERRY_GC_GENERATIONAL != 1) */
 #if (JERRY_LCACHE != 0) && (JERRY_LCACHE != 1)
 #error "Invalid value for 'JERRY_LCACHE' macro."
 #endif /* (JERRY_LCACHE != 0) && (JERRY_LCACHE != 1) */
+#if (JERRY_VM_INLINE_CACHE != 0) && (JERRY_VM_INLINE_CACHE != 1)
+#error "Invalid value for 'JERRY_VM_INLINE_CACHE' macro."
+#endif /* (JERRY_VM_INLINE_CACHE != 0) && (JERRY_VM_INLINE_CACHE != 1) */
 #if (JERRY_FUNCTION_TO_STRING != 0) && (JERRY_FUNCTION_TO_STRING != 1)
 #error "Invalid value for 'JERRY_FUNCTION_TO_STRING' macro."
 #endif /* (JERRY_FUNCTION_TO_STRING != 0) && (JERRY_FUNCTION_TO_STRING != 1) */
@@ -619,6 +681,15 @@
 #if (JERRY_MEM_STATS != 0) && (JERRY_MEM_STATS != 1)
 #error "Invalid value for 'JERRY_MEM_STATS' macro."
 #endif /* (JERRY_MEM_STATS != 0) && (JERRY_MEM_STATS != 1) */
+#if (JERRY_MEM_POOL_MAX_CHUNK_SIZE < 8) || (JERRY_MEM_POOL_MAX_CHUNK_SIZE > 128)
+#error "Invalid value for 'JERRY_MEM_POOL_MAX_CHUNK_SIZE' macro."
+#endif /* (JERRY_MEM_POOL_MAX_CHUNK_SIZE < 8) || (JERRY_MEM_POOL_MAX_CHUNK_SIZE > 128) */
+#if JERRY_MEM_POOL_MAX_CHUNK_SIZE % 8 != 0
+#error "JERRY_MEM_POOL_MAX_CHUNK_SIZE must be a multiple of 8."
+#endif /* JERRY_MEM_POOL_MAX_CHUNK_SIZE % 8 != 0 */
+#if JERRY_CPOINTER_32_BIT && (JERRY_MEM_POOL_MAX_CHUNK_SIZE < 16)
+#error "JERRY_MEM_POOL_MAX_CHUNK_SIZE must be at least 16 when JERRY_CPOINTER_32_BIT is enabled."
+#endif /* JERRY_CPOINTER_32_BIT && (JERRY_MEM_POOL_MAX_CHUNK_SIZE < 16) */
 #if (JERRY_NUMBER_TYPE_FLOAT64 != 0) && (JERRY_NUMBER_TYPE_FLOAT64 != 1)
 #error "Invalid value for 'JERRY_NUMBER_TYPE_FLOAT64' macro."
 #endif /* (JERRY_NUMBER_TYPE_FLOAT64 != 0) && (JERRY_NUMBER_TYPE_FLOAT64 != 1) */
@@ -661,11 +732,21 @@
 #if (JERRY_VM_THROW != 0) && (JERRY_VM_THROW != 1)
 #error "Invalid value for 'JERRY_VM_THROW' macro."
 #endif /* (JERRY_VM_THROW != 0) && (JERRY_VM_THROW != 1) */
+#if (JERRY_VM_COMPUTED_GOTO != 0) && (JERRY_VM_COMPUTED_GOTO != 1)
+#error "Invalid value for 'JERRY_VM_COMPUTED_GOTO' macro."
+#endif /* (JERRY_VM_COMPUTED_GOTO != 0) && (JERRY_VM_COMPUTED_GOTO != 1) */
 
 /**
  * Cross component requirements check.
  */
 
+/**
+ * The generational garbage collector tracks the objects by their position in the static heap.
+ */
+#if JERRY_GC_GENERATIONAL && (JERRY_SYSTEM_ALLOCATOR || JERRY_EXTERNAL_CONTEXT)
+#error "JERRY_GC_GENERATIONAL cannot be enabled together with JERRY_SYSTEM_ALLOCATOR or JERRY_EXTERNAL_CONTEXT"
+#endif /* JERRY_GC_GENERATIONAL && (JERRY_SYSTEM_ALLOCATOR || JERRY_EXTERNAL_CONTEXT) */
+
 /**
  * The date module can only use the float 64 number types.
  */
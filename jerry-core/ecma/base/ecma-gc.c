@@ -39,6 +39,7 @@
 #include "re-compiler.h"
 #include "vm-defines.h"
 #include "vm-stack.h"
+#include "vm.h"
 
 #if JERRY_BUILTIN_TYPEDARRAY
 #include "ecma-typedarray-object.h"
@@ -88,6 +89,14 @@ ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
 {
   if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
   {
+    if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL)
+    {
+      /* Gray objects are marked when an incremental marking pass finds them. */
+      object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+      JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_NEW_GRAY;
+      return;
+    }
+
 #if (JERRY_GC_MARK_LIMIT != 0)
     if (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) != 0)
     {
@@ -110,6 +119,72 @@ ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
   }
 } /* ecma_gc_set_object_visited */
 
+#if JERRY_GC_GENERATIONAL
+
+/**
+ * Get the index of the bit which belongs to the object in the bitmaps of the generations.
+ */
+#define ECMA_GC_BITMAP_INDEX(object_p) \
+  ((size_t) ((uint8_t *) (object_p) - (uint8_t *) &JERRY_HEAP_CONTEXT (first)) >> JMEM_ALIGNMENT_LOG)
+
+/**
+ * Check whether the object is a young object.
+ *
+ * Note:
+ *      the young objects which are stored outside of the objects are promoted
+ *      before the next minor garbage collection, and they are not young anymore
+ *
+ * @return true  - if the object is young
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_is_object_young (ecma_object_t *object_p) /**< object */
+{
+  size_t bit_index = ECMA_GC_BITMAP_INDEX (object_p);
+
+  return (JERRY_CONTEXT (ecma_gc_young_bitmap)[bit_index / JERRY_BITSINBYTE]
+          & (1u << (bit_index % JERRY_BITSINBYTE))) != 0;
+} /* ecma_gc_is_object_young */
+
+/**
+ * Set the young flag of the object.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_set_object_young (ecma_object_t *object_p) /**< object */
+{
+  size_t bit_index = ECMA_GC_BITMAP_INDEX (object_p);
+
+  JERRY_CONTEXT (ecma_gc_young_bitmap)[bit_index / JERRY_BITSINBYTE] |=
+    (uint8_t) (1u << (bit_index % JERRY_BITSINBYTE));
+} /* ecma_gc_set_object_young */
+
+/**
+ * Clear the young flag of the object.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_clear_object_young (ecma_object_t *object_p) /**< object */
+{
+  size_t bit_index = ECMA_GC_BITMAP_INDEX (object_p);
+
+  JERRY_CONTEXT (ecma_gc_young_bitmap)[bit_index / JERRY_BITSINBYTE] &=
+    (uint8_t) ~(1u << (bit_index % JERRY_BITSINBYTE));
+} /* ecma_gc_clear_object_young */
+
+/**
+ * Add an old object to the remembered set, which contains the old objects
+ * that may reference young objects.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_set_object_remembered (ecma_object_t *object_p) /**< object */
+{
+  size_t bit_index = ECMA_GC_BITMAP_INDEX (object_p);
+
+  JERRY_CONTEXT (ecma_gc_remembered_bitmap)[bit_index / JERRY_BITSINBYTE] |=
+    (uint8_t) (1u << (bit_index % JERRY_BITSINBYTE));
+} /* ecma_gc_set_object_remembered */
+
+#endif /* JERRY_GC_GENERATIONAL */
+
 /**
  * Initialize GC information for the object
  */
@@ -124,6 +199,10 @@ ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 
   object_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
   ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_objects_cp), object_p);
+
+#if JERRY_GC_GENERATIONAL
+  ecma_gc_set_object_young (object_p);
+#endif /* JERRY_GC_GENERATIONAL */
 } /* ecma_init_gc_info */
 
 /**
@@ -136,12 +215,89 @@ ecma_ref_object_inline (ecma_object_t *object_p) /**< object */
   {
     object_p->type_flags_refs = (ecma_object_descriptor_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
   }
+  else if ((JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL)
+           && object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
+  {
+    /* Referencing a non-visited object during incremental marking turns it gray. */
+    object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+    object_p->type_flags_refs = (ecma_object_descriptor_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
+    JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_NEW_GRAY;
+  }
   else
   {
     jerry_fatal (JERRY_FATAL_REF_COUNT_LIMIT);
   }
 } /* ecma_ref_object_inline */
 
+/**
+ * Turn a non-visited object gray while an incremental garbage collection cycle is marking objects.
+ *
+ * Note:
+ *      references stored into the heap are not counted, so these stores must
+ *      not hide non-visited objects from the marker
+ */
+void
+ecma_gc_shade_object (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL);
+
+  if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
+  {
+    object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+    JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_NEW_GRAY;
+  }
+} /* ecma_gc_shade_object */
+
+/**
+ * Notify the garbage collector that a reference to the object is stored into the heap.
+ *
+ * Note:
+ *      references stored into the heap are not counted, so every store which
+ *      does not use ecma_copy_value_if_not_object must call this function
+ */
+extern inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_write_barrier (ecma_object_t *holder_p, /**< object which holds the reference,
+                                                 *   NULL if the reference is stored outside of the objects */
+                       ecma_object_t *object_p) /**< stored object */
+{
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL))
+  {
+    ecma_gc_shade_object (object_p);
+  }
+
+#if JERRY_GC_GENERATIONAL
+  if (ecma_gc_is_object_young (object_p))
+  {
+    if (holder_p == NULL)
+    {
+      /* Minor garbage collections cannot find these references, so the object is treated as a root. */
+      ecma_gc_clear_object_young (object_p);
+    }
+    else if (!ecma_gc_is_object_young (holder_p))
+    {
+      /* Minor garbage collections only mark the old objects which are remembered. */
+      ecma_gc_set_object_remembered (holder_p);
+    }
+  }
+#else /* !JERRY_GC_GENERATIONAL */
+  JERRY_UNUSED (holder_p);
+#endif /* JERRY_GC_GENERATIONAL */
+} /* ecma_gc_write_barrier */
+
+/**
+ * Notify the garbage collector that the value is stored into the heap if it is an object.
+ */
+void
+ecma_gc_write_barrier_value (ecma_object_t *holder_p, /**< object which holds the reference,
+                                                       *   NULL if the reference is stored outside of the objects */
+                             ecma_value_t value) /**< stored value */
+{
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_write_barrier (holder_p, ecma_get_object_from_value (value));
+  }
+} /* ecma_gc_write_barrier_value */
+
 /**
  * Increase reference counter of an object
  */
@@ -1538,6 +1694,10 @@ ecma_gc_free_property (ecma_object_t *object_p, /**< object */
   }
 #endif /* JERRY_LCACHE */
 
+#if JERRY_VM_INLINE_CACHE
+  vm_inline_cache_invalidate ();
+#endif /* JERRY_VM_INLINE_CACHE */
+
   if (ECMA_PROPERTY_IS_RAW (property))
   {
     if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR)
@@ -2103,30 +2263,39 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
   ecma_dealloc_extended_object (object_p, ext_object_size);
 } /* ecma_gc_free_object */
 
+#if JERRY_GC_GENERATIONAL
+
 /**
- * Run garbage collection, freeing objects that are no longer referenced.
+ * Promote all objects to the old generation after a full garbage collection.
  */
-void
-ecma_gc_run (void)
+static void
+ecma_gc_promote_all_objects (void)
 {
-#if (JERRY_GC_MARK_LIMIT != 0)
-  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  memset (JERRY_CONTEXT (ecma_gc_young_bitmap), 0, sizeof (JERRY_CONTEXT (ecma_gc_young_bitmap)));
+  memset (JERRY_CONTEXT (ecma_gc_remembered_bitmap), 0, sizeof (JERRY_CONTEXT (ecma_gc_remembered_bitmap)));
 
-  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+  JERRY_CONTEXT (ecma_gc_old_objects_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+  JERRY_CONTEXT (ecma_gc_old_objects_number) = JERRY_CONTEXT (ecma_gc_objects_number);
+} /* ecma_gc_promote_all_objects */
 
-  ecma_object_t black_list_head;
-  black_list_head.gc_next_cp = JMEM_CP_NULL;
-  ecma_object_t *black_end_p = &black_list_head;
+#endif /* JERRY_GC_GENERATIONAL */
 
-  ecma_object_t white_gray_list_head;
-  white_gray_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+/**
+ * Move root objects (i.e. they have global or stack references) of the object list to the black list,
+ * and set the rest of the objects non-visited.
+ *
+ * @return last item of the black list
+ */
+static ecma_object_t *
+ecma_gc_collect_roots (ecma_object_t *black_list_head_p, /**< [out] head of the black list */
+                       ecma_object_t *white_gray_list_head_p) /**< [in, out] head of the object list */
+{
+  ecma_object_t *black_end_p = black_list_head_p;
 
-  ecma_object_t *obj_prev_p = &white_gray_list_head;
+  ecma_object_t *obj_prev_p = white_gray_list_head_p;
   jmem_cpointer_t obj_iter_cp = obj_prev_p->gc_next_cp;
   ecma_object_t *obj_iter_p;
 
-  /* Move root objects (i.e. they have global or stack references) to the black list. */
   while (obj_iter_cp != JMEM_CP_NULL)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
@@ -2153,9 +2322,50 @@ ecma_gc_run (void)
   }
 
   black_end_p->gc_next_cp = JMEM_CP_NULL;
+  return black_end_p;
+} /* ecma_gc_collect_roots */
+
+/**
+ * Free the objects of a list which are not marked by the garbage collector.
+ */
+static void
+ecma_gc_sweep (jmem_cpointer_t obj_iter_cp) /**< first item of the list */
+{
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+
+    ecma_gc_free_object (obj_iter_p);
+    obj_iter_cp = obj_next_cp;
+  }
+
+#if JERRY_BUILTIN_REGEXP
+  /* Free RegExp bytecodes stored in cache */
+  re_cache_gc ();
+#endif /* JERRY_BUILTIN_REGEXP */
+} /* ecma_gc_sweep */
+
+/**
+ * Mark the objects of a list which are reachable from the black list, which contains the
+ * root objects collected by ecma_gc_collect_roots. The marked objects are moved to the
+ * black list, and the rest is kept on the object list.
+ *
+ * @return last item of the black list
+ */
+static ecma_object_t *
+ecma_gc_mark_objects (ecma_object_t *black_list_head_p, /**< [in, out] head of the black list */
+                      ecma_object_t *black_end_p, /**< last item of the black list */
+                      ecma_object_t *white_gray_list_head_p) /**< [in, out] head of the object list */
+{
+  ecma_object_t *obj_prev_p;
+  jmem_cpointer_t obj_iter_cp;
+  ecma_object_t *obj_iter_p;
 
   /* Mark root objects. */
-  obj_iter_cp = black_list_head.gc_next_cp;
+  obj_iter_cp = black_list_head_p->gc_next_cp;
   while (obj_iter_cp != JMEM_CP_NULL)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
@@ -2174,7 +2384,7 @@ ecma_gc_run (void)
 
     marked_anything_during_current_iteration = false;
 
-    obj_prev_p = &white_gray_list_head;
+    obj_prev_p = white_gray_list_head_p;
     obj_iter_cp = obj_prev_p->gc_next_cp;
 
     while (obj_iter_cp != JMEM_CP_NULL)
@@ -2215,27 +2425,532 @@ ecma_gc_run (void)
   } while (marked_anything_during_current_iteration);
 
   black_end_p->gc_next_cp = JMEM_CP_NULL;
+  return black_end_p;
+} /* ecma_gc_mark_objects */
+
+/**
+ * Run garbage collection, freeing objects that are no longer referenced.
+ *
+ * Note:
+ *      a pending incremental garbage collection cycle is cancelled first
+ */
+void
+ecma_gc_run (void)
+{
+#if (JERRY_GC_MARK_LIMIT != 0)
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
+#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL))
+  {
+    ecma_gc_incremental_cancel ();
+  }
+
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+
+  ecma_object_t black_list_head;
+  black_list_head.gc_next_cp = JMEM_CP_NULL;
+
+  ecma_object_t white_gray_list_head;
+  white_gray_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  ecma_object_t *black_end_p = ecma_gc_collect_roots (&black_list_head, &white_gray_list_head);
+  ecma_gc_mark_objects (&black_list_head, black_end_p, &white_gray_list_head);
   JERRY_CONTEXT (ecma_gc_objects_cp) = black_list_head.gc_next_cp;
 
   /* Sweep objects that are currently unmarked. */
-  obj_iter_cp = white_gray_list_head.gc_next_cp;
+  ecma_gc_sweep (white_gray_list_head.gc_next_cp);
+
+#if JERRY_GC_GENERATIONAL
+  ecma_gc_promote_all_objects ();
+#endif /* JERRY_GC_GENERATIONAL */
+} /* ecma_gc_run */
+
+#if JERRY_GC_GENERATIONAL
+
+static void ecma_gc_incremental_finish (void);
+
+/**
+ * Mark the young objects referenced by the remembered old objects.
+ */
+static void
+ecma_gc_mark_remembered_objects (void)
+{
+  uint8_t *bitmap_p = JERRY_CONTEXT (ecma_gc_remembered_bitmap);
+
+  for (size_t i = 0; i < CONFIG_ECMA_GC_BITMAP_SIZE; i++)
+  {
+    if (bitmap_p[i] == 0)
+    {
+      continue;
+    }
+
+    for (size_t bit_index = 0; bit_index < JERRY_BITSINBYTE; bit_index++)
+    {
+      if (bitmap_p[i] & (1u << bit_index))
+      {
+        size_t offset = ((i * JERRY_BITSINBYTE) + bit_index) << JMEM_ALIGNMENT_LOG;
+        ecma_object_t *object_p = (ecma_object_t *) ((uint8_t *) &JERRY_HEAP_CONTEXT (first) + offset);
+
+        /* Old objects are not marked, so they are seen as visited objects. */
+        JERRY_ASSERT (!ecma_gc_is_object_young (object_p) && ecma_gc_is_object_visited (object_p));
+        ecma_gc_mark (object_p);
+      }
+    }
+  }
+} /* ecma_gc_mark_remembered_objects */
+
+/**
+ * Run a minor garbage collection, which frees the unreachable objects of the young generation.
+ *
+ * The young generation is the list of objects allocated since the last garbage collection,
+ * which are stored at the beginning of the ecma_gc_objects_cp list. Old objects are neither
+ * marked nor freed, so the roots of the young generation are the referenced young objects,
+ * the young objects stored outside of the objects, and the references of the old objects
+ * which are remembered by ecma_gc_write_barrier. The surviving young objects are promoted
+ * to the old generation.
+ */
+static void
+ecma_gc_run_minor (void)
+{
+#if (JERRY_GC_MARK_LIMIT != 0)
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
+#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL)
+  {
+    /* The objects of an incremental cycle are not ordered by generations,
+     * so the pending cycle is completed instead, which collects all objects. */
+    ecma_gc_incremental_finish ();
+    return;
+  }
+
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+
+  const jmem_cpointer_t old_objects_cp = JERRY_CONTEXT (ecma_gc_old_objects_cp);
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+  ecma_object_t *young_end_p = NULL;
+
+  /* The objects stored outside of the objects are referenced while the young generation is marked. */
+  while (obj_iter_cp != old_objects_cp)
+  {
+    young_end_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (!ecma_gc_is_object_young (young_end_p))
+    {
+      ecma_ref_object_inline (young_end_p);
+    }
+
+    obj_iter_cp = young_end_p->gc_next_cp;
+  }
+
+  if (young_end_p == NULL)
+  {
+    return;
+  }
+
+  young_end_p->gc_next_cp = JMEM_CP_NULL;
+
+  ecma_object_t black_list_head;
+  black_list_head.gc_next_cp = JMEM_CP_NULL;
+
+  ecma_object_t white_gray_list_head;
+  white_gray_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  ecma_object_t *black_end_p = ecma_gc_collect_roots (&black_list_head, &white_gray_list_head);
+  ecma_gc_mark_remembered_objects ();
+  black_end_p = ecma_gc_mark_objects (&black_list_head, black_end_p, &white_gray_list_head);
+
+  /* Promote the surviving objects to the old generation. */
+  obj_iter_cp = black_list_head.gc_next_cp;
 
   while (obj_iter_cp != JMEM_CP_NULL)
   {
-    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
-    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
 
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+    if (ecma_gc_is_object_young (obj_iter_p))
+    {
+      ecma_gc_clear_object_young (obj_iter_p);
+    }
+    else
+    {
+      ecma_deref_object (obj_iter_p);
+    }
 
-    ecma_gc_free_object (obj_iter_p);
-    obj_iter_cp = obj_next_cp;
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  /* No young objects are left, so the old objects cannot reference young objects. */
+  memset (JERRY_CONTEXT (ecma_gc_remembered_bitmap), 0, sizeof (JERRY_CONTEXT (ecma_gc_remembered_bitmap)));
+
+  if (black_end_p == &black_list_head)
+  {
+    JERRY_CONTEXT (ecma_gc_objects_cp) = old_objects_cp;
+  }
+  else
+  {
+    black_end_p->gc_next_cp = old_objects_cp;
+    JERRY_CONTEXT (ecma_gc_objects_cp) = black_list_head.gc_next_cp;
+  }
+
+  JERRY_CONTEXT (ecma_gc_old_objects_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  /* Sweep young objects that are currently unmarked. */
+  ecma_gc_sweep (white_gray_list_head.gc_next_cp);
+} /* ecma_gc_run_minor */
+
+#endif /* JERRY_GC_GENERATIONAL */
+
+/*
+ * Incremental garbage collection
+ *
+ * An incremental cycle splits the object list into a black (marked) and a white (non-marked) list
+ * when it starts, and the objects allocated during the cycle are collected on the usual object
+ * list. These new objects are considered alive until the cycle completes. The marking work is
+ * split into bounded steps, and the engine keeps running between the steps:
+ *  - gray objects stay in the white list until a marking pass finds them and moves
+ *    them to the end of the black list, where they are marked later
+ *  - referencing a non-visited object (see ecma_ref_object_inline) turns it gray, because
+ *    the engine cannot keep a counted reference to an object without the marker seeing it
+ *  - storing an object into the heap (see ecma_gc_write_barrier) also turns it gray, because
+ *    heap references are not counted. This includes the stores into the new objects, so
+ *    their references are never marked.
+ * Marking is completed by a pass which walks the whole white list while no object is turned
+ * gray (see ECMA_STATUS_GC_NEW_GRAY). The black objects are moved back to the object list, and
+ * the following steps free the white objects. The cycle is completed when the white list is empty.
+ *
+ * The budget of a step is counted in objects, which are visited by marking or freed by sweeping,
+ * rather than in time: the core has no clock, and the cost of a step is deterministic this way.
+ */
+
+/**
+ * Append an object to the black list of the current incremental garbage collection cycle.
+ */
+static void
+ecma_gc_incremental_append_black (ecma_object_t *object_p, /**< object */
+                                  jmem_cpointer_t object_cp) /**< compressed pointer of the object */
+{
+  object_p->gc_next_cp = JMEM_CP_NULL;
+
+  if (JERRY_CONTEXT (ecma_gc_black_end_cp) == JMEM_CP_NULL)
+  {
+    JERRY_CONTEXT (ecma_gc_black_cp) = object_cp;
+  }
+  else
+  {
+    ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_black_end_cp))->gc_next_cp = object_cp;
+  }
+
+  JERRY_CONTEXT (ecma_gc_black_end_cp) = object_cp;
+
+  if (JERRY_CONTEXT (ecma_gc_scan_cp) == JMEM_CP_NULL)
+  {
+    JERRY_CONTEXT (ecma_gc_scan_cp) = object_cp;
+  }
+} /* ecma_gc_incremental_append_black */
+
+/**
+ * Start an incremental garbage collection cycle.
+ */
+static void
+ecma_gc_incremental_start (void)
+{
+  JERRY_ASSERT (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL));
+
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+
+  ecma_object_t black_list_head;
+  black_list_head.gc_next_cp = JMEM_CP_NULL;
+
+  ecma_object_t white_gray_list_head;
+  white_gray_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  ecma_object_t *black_end_p = ecma_gc_collect_roots (&black_list_head, &white_gray_list_head);
+
+  JERRY_CONTEXT (ecma_gc_objects_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_black_cp) = black_list_head.gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_black_end_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_scan_cp) = black_list_head.gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_white_cp) = white_gray_list_head.gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_pass_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_NEW_GRAY;
+
+  if (black_end_p != &black_list_head)
+  {
+    ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_black_end_cp), black_end_p);
+  }
+
+  JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_INCREMENTAL;
+} /* ecma_gc_incremental_start */
+
+/**
+ * Mark objects of the current incremental garbage collection cycle.
+ *
+ * @return true - if a complete marking pass found no gray objects, and no
+ *                objects were turned gray since the pass was started
+ *         false - if the budget is exhausted before
+ */
+static bool
+ecma_gc_incremental_mark (uint32_t *budget_p) /**< [in, out] number of objects which can be visited */
+{
+  while (true)
+  {
+    /* Mark the references of the black objects. */
+    while (JERRY_CONTEXT (ecma_gc_scan_cp) != JMEM_CP_NULL)
+    {
+      if (*budget_p == 0)
+      {
+        return false;
+      }
+
+      (*budget_p)--;
+
+      ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_scan_cp));
+      JERRY_CONTEXT (ecma_gc_scan_cp) = object_p->gc_next_cp;
+      ecma_gc_mark (object_p);
+    }
+
+    /* Move the gray objects to the black list. */
+    jmem_cpointer_t obj_prev_cp = JERRY_CONTEXT (ecma_gc_pass_cp);
+    jmem_cpointer_t obj_iter_cp;
+
+    if (obj_prev_cp == JMEM_CP_NULL)
+    {
+      /* A pass started from the beginning finds all objects which are currently gray. */
+      JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_NEW_GRAY;
+      obj_iter_cp = JERRY_CONTEXT (ecma_gc_white_cp);
+    }
+    else
+    {
+      obj_iter_cp = ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_cp)->gc_next_cp;
+    }
+
+    while (obj_iter_cp != JMEM_CP_NULL)
+    {
+      if (*budget_p == 0)
+      {
+        JERRY_CONTEXT (ecma_gc_pass_cp) = obj_prev_cp;
+        return false;
+      }
+
+      (*budget_p)--;
+
+      ecma_object_t *obj_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+      const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+      if (ecma_gc_is_object_visited (obj_iter_p))
+      {
+        if (obj_prev_cp == JMEM_CP_NULL)
+        {
+          JERRY_CONTEXT (ecma_gc_white_cp) = obj_next_cp;
+        }
+        else
+        {
+          ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_cp)->gc_next_cp = obj_next_cp;
+        }
+
+        ecma_gc_incremental_append_black (obj_iter_p, obj_iter_cp);
+      }
+      else
+      {
+        obj_prev_cp = obj_iter_cp;
+      }
+
+      obj_iter_cp = obj_next_cp;
+    }
+
+    JERRY_CONTEXT (ecma_gc_pass_cp) = JMEM_CP_NULL;
+
+    /* Objects turned gray during the pass might be in the part of the white list which
+     * was checked before, so the pass must be repeated until no objects are turned gray. */
+    if (JERRY_CONTEXT (ecma_gc_scan_cp) == JMEM_CP_NULL
+        && !(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_NEW_GRAY))
+    {
+      return true;
+    }
+  }
+} /* ecma_gc_incremental_mark */
+
+/**
+ * Complete the marking of the current incremental garbage collection cycle: the black
+ * objects are moved back to the object list, and the white objects are going to be freed.
+ */
+static void
+ecma_gc_incremental_start_sweep (void)
+{
+  JERRY_ASSERT (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_SWEEP));
+
+  if (JERRY_CONTEXT (ecma_gc_black_end_cp) != JMEM_CP_NULL)
+  {
+    ecma_object_t *black_end_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_black_end_cp));
+    black_end_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+    JERRY_CONTEXT (ecma_gc_objects_cp) = JERRY_CONTEXT (ecma_gc_black_cp);
+  }
+
+  JERRY_CONTEXT (ecma_gc_black_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_black_end_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_SWEEP;
+} /* ecma_gc_incremental_start_sweep */
+
+/**
+ * Free the white objects of the current incremental garbage collection cycle.
+ *
+ * @return true - if all white objects are freed, and the cycle is completed
+ *         false - if the budget is exhausted before
+ */
+static bool
+ecma_gc_incremental_sweep (uint32_t *budget_p) /**< [in, out] number of objects which can be freed */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_SWEEP);
+
+  while (JERRY_CONTEXT (ecma_gc_white_cp) != JMEM_CP_NULL)
+  {
+    if (*budget_p == 0)
+    {
+      return false;
+    }
+
+    (*budget_p)--;
+
+    ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_white_cp));
+    JERRY_CONTEXT (ecma_gc_white_cp) = object_p->gc_next_cp;
+
+    JERRY_ASSERT (!ecma_gc_is_object_visited (object_p));
+    ecma_gc_free_object (object_p);
   }
 
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~(ECMA_STATUS_GC_INCREMENTAL | ECMA_STATUS_GC_SWEEP);
+
 #if JERRY_BUILTIN_REGEXP
   /* Free RegExp bytecodes stored in cache */
   re_cache_gc ();
 #endif /* JERRY_BUILTIN_REGEXP */
-} /* ecma_gc_run */
+
+#if JERRY_GC_GENERATIONAL
+  ecma_gc_promote_all_objects ();
+#endif /* JERRY_GC_GENERATIONAL */
+
+  return true;
+} /* ecma_gc_incremental_sweep */
+
+/**
+ * Complete the current incremental garbage collection cycle without interruption.
+ */
+static void
+ecma_gc_incremental_finish (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL);
+
+  while (!ecma_gc_incremental_step (UINT32_MAX))
+  {
+  }
+} /* ecma_gc_incremental_finish */
+
+/**
+ * Cancel the current incremental garbage collection cycle, and move
+ * all objects back to the list of currently alive objects.
+ *
+ * Note:
+ *      the white objects are unreachable once the marking is completed,
+ *      so the cycle is completed instead when it already frees them
+ */
+void
+ecma_gc_incremental_cancel (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL);
+
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_SWEEP)
+  {
+    uint32_t budget = UINT32_MAX;
+    ecma_gc_incremental_sweep (&budget);
+    return;
+  }
+
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~(ECMA_STATUS_GC_INCREMENTAL | ECMA_STATUS_GC_NEW_GRAY);
+
+  jmem_cpointer_t *list_end_p = &JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (*list_end_p != JMEM_CP_NULL)
+  {
+    list_end_p = &ECMA_GET_NON_NULL_POINTER (ecma_object_t, *list_end_p)->gc_next_cp;
+  }
+
+  *list_end_p = JERRY_CONTEXT (ecma_gc_black_cp);
+
+  if (JERRY_CONTEXT (ecma_gc_black_end_cp) != JMEM_CP_NULL)
+  {
+    list_end_p = &ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_black_end_cp))->gc_next_cp;
+  }
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_white_cp);
+  *list_end_p = obj_iter_cp;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
+    {
+      obj_iter_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+    }
+
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+#if JERRY_GC_GENERATIONAL
+  /* The order of the objects is changed, so the young objects are promoted
+   * to the old generation, and the next full garbage collection frees them. */
+  ecma_gc_promote_all_objects ();
+#endif /* JERRY_GC_GENERATIONAL */
+} /* ecma_gc_incremental_cancel */
+
+/**
+ * Perform a bounded amount of incremental garbage collection work. A new
+ * cycle is started when no incremental garbage collection cycle is in progress.
+ *
+ * Note:
+ *      the budget is shared by the marking and the sweeping work of the step
+ *
+ * @return true - if the cycle is completed by this step
+ *         false - otherwise
+ */
+bool
+ecma_gc_incremental_step (uint32_t budget) /**< number of objects which can be visited or freed */
+{
+  if (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL))
+  {
+    ecma_gc_incremental_start ();
+  }
+
+  if (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_SWEEP))
+  {
+    if (!ecma_gc_incremental_mark (&budget))
+    {
+      return false;
+    }
+
+    ecma_gc_incremental_start_sweep ();
+  }
+
+  return ecma_gc_incremental_sweep (&budget);
+} /* ecma_gc_incremental_step */
+
+/**
+ * Check whether the object is found unreachable by the current incremental garbage
+ * collection cycle, and it is going to be freed by the following steps of the cycle.
+ *
+ * Note:
+ *      only weak references can refer to such objects
+ *
+ * @return true - if the object is going to be freed
+ *         false - otherwise
+ */
+bool
+ecma_gc_is_object_unreachable (ecma_object_t *object_p) /**< object */
+{
+  return ((JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_SWEEP)
+          && object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED);
+} /* ecma_gc_is_object_unreachable */
 
 /**
  * Try to free some memory (depending on memory pressure).
@@ -2271,7 +2986,22 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
 
     if (JERRY_CONTEXT (ecma_gc_new_objects) * new_objects_fraction > JERRY_CONTEXT (ecma_gc_objects_number))
     {
-      ecma_gc_run ();
+      if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_INCREMENTAL)
+      {
+        /* Complete the pending incremental cycle instead of dropping its marking work. */
+        ecma_gc_incremental_finish ();
+      }
+#if JERRY_GC_GENERATIONAL
+      else if (JERRY_CONTEXT (ecma_gc_objects_number) < JERRY_CONTEXT (ecma_gc_old_objects_number) * 2)
+      {
+        /* Old objects are only collected when their number is doubled since the last full collection. */
+        ecma_gc_run_minor ();
+      }
+#endif /* JERRY_GC_GENERATIONAL */
+      else
+      {
+        ecma_gc_run ();
+      }
     }
 
     return;
@@ -43,7 +43,13 @@ void ecma_ref_object_inline (ecma_object_t *object_p);
 void ecma_deref_object (ecma_object_t *object_p);
 void ecma_gc_free_property (ecma_object_t *object_p, ecma_property_pair_t *prop_pair_p, uint32_t options);
 void ecma_gc_free_properties (ecma_object_t *object_p, uint32_t options);
+void ecma_gc_shade_object (ecma_object_t *object_p);
+void ecma_gc_write_barrier (ecma_object_t *holder_p, ecma_object_t *object_p);
+void ecma_gc_write_barrier_value (ecma_object_t *holder_p, ecma_value_t value);
 void ecma_gc_run (void);
+bool ecma_gc_incremental_step (uint32_t budget);
+void ecma_gc_incremental_cancel (void);
+bool ecma_gc_is_object_unreachable (ecma_object_t *object_p);
 void ecma_free_unused_memory (jmem_pressure_t pressure);
 
 /**
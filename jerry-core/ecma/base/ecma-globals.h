@@ -67,6 +67,9 @@ typedef enum
 #if JERRY_VM_THROW
   ECMA_STATUS_ERROR_THROWN = (1u << 6), /**< the vm_throw_callback_p is called */
 #endif /* JERRY_VM_THROW */
+  ECMA_STATUS_GC_INCREMENTAL = (1u << 7), /**< an incremental garbage collection cycle is in progress */
+  ECMA_STATUS_GC_NEW_GRAY = (1u << 8), /**< an object is turned gray since the current marking pass is started */
+  ECMA_STATUS_GC_SWEEP = (1u << 9), /**< the incremental garbage collection cycle frees the non-marked objects */
 } ecma_status_flag_t;
 
 /**
@@ -1262,6 +1265,40 @@ typedef struct
   ecma_value_t value; /**< value of the key */
 } ecma_container_pair_t;
 
+/**
+ * Hash index of a container.
+ *
+ * The index is followed by (mask + 1) uint32_t slots. Each slot is either
+ * ECMA_CONTAINER_HASH_SLOT_EMPTY, ECMA_CONTAINER_HASH_SLOT_DELETED or the
+ * offset of an entry (relative to ECMA_CONTAINER_START) increased by
+ * ECMA_CONTAINER_HASH_SLOT_OFFSET.
+ */
+typedef struct
+{
+  uint32_t mask; /**< number of slots - 1 (the number of slots is a power of 2) */
+  uint32_t used_count; /**< number of non-empty (including deleted) slots */
+} ecma_container_hash_index_t;
+
+/**
+ * Minimum number of entries before a hash index is created for a container.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_MINIMUM_SIZE 16
+
+/**
+ * Unused slot of a container hash index.
+ */
+#define ECMA_CONTAINER_HASH_SLOT_EMPTY 0
+
+/**
+ * Slot of a deleted entry in a container hash index.
+ */
+#define ECMA_CONTAINER_HASH_SLOT_DELETED 1
+
+/**
+ * Value added to the entry offsets stored in a container hash index.
+ */
+#define ECMA_CONTAINER_HASH_SLOT_OFFSET 2
+
 /**
  * Size of a single element (in ecma_value_t unit).
  */
@@ -1272,6 +1309,11 @@ typedef struct
  */
 #define ECMA_CONTAINER_PAIR_SIZE 2
 
+/**
+ * Number of header values at the beginning of the internal buffer (size and hash index).
+ */
+#define ECMA_CONTAINER_HEADER_SIZE 2
+
 /**
  * Size of the internal buffer.
  */
@@ -1282,15 +1324,20 @@ typedef struct
  */
 #define ECMA_CONTAINER_SET_SIZE(container_p, size) (container_p->buffer_p[0] = (ecma_value_t) (size))
 
+/**
+ * Internal pointer to the hash index of the internal buffer (can be NULL).
+ */
+#define ECMA_CONTAINER_HASH_INDEX(container_p) (container_p->buffer_p[1])
+
 /**
  * Number of entries of the internal buffer.
  */
-#define ECMA_CONTAINER_ENTRY_COUNT(collection_p) (collection_p->item_count - 1)
+#define ECMA_CONTAINER_ENTRY_COUNT(collection_p) (collection_p->item_count - ECMA_CONTAINER_HEADER_SIZE)
 
 /**
  * Pointer to the first entry of the internal buffer.
  */
-#define ECMA_CONTAINER_START(collection_p) (collection_p->buffer_p + 1)
+#define ECMA_CONTAINER_START(collection_p) (collection_p->buffer_p + ECMA_CONTAINER_HEADER_SIZE)
 
 #endif /* JERRY_BUILTIN_CONTAINER */
 
@@ -1518,8 +1565,10 @@ typedef enum
                                             *   maximum size is 2^16. */
   ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
   ECMA_STRING_CONTAINER_SYMBOL, /**< the ecma-string is a symbol */
+  ECMA_STRING_CONTAINER_ROPE_STRING, /**< lazy concatenation of two strings, the characters
+                                      *   are copied into a single buffer on first access */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_SYMBOL /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_ROPE_STRING /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1618,6 +1667,31 @@ typedef struct
   void *user_p; /**< user pointer passed to the callback when the string is freed */
 } ecma_external_string_t;
 
+/**
+ * Rope string-value descriptor
+ *
+ * Note:
+ *   The string_p field of the header is NULL until the rope is flattened. The right
+ *   operand is never an unflattened rope, so ropes only grow along their left operands.
+ */
+typedef struct
+{
+  ecma_long_string_t header; /**< long string header */
+  ecma_value_t left; /**< left operand of the concatenation */
+  ecma_value_t right; /**< right operand of the concatenation */
+} ecma_rope_string_t;
+
+/**
+ * Minimum size of the left operand of a concatenation which creates a rope string.
+ * Shorter strings are cheaper to copy.
+ */
+#define ECMA_ROPE_STRING_MIN_SIZE 1024
+
+/**
+ * Maximum size of a right operand which is created by merging short right operands.
+ */
+#define ECMA_ROPE_STRING_LEAF_SIZE 512
+
 /**
  * Header size of an ecma ASCII string
  */
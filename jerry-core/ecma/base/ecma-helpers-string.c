@@ -57,6 +57,9 @@ JERRY_STATIC_ASSERT (ECMA_PROPERTY_NAME_TYPE_SHIFT > ECMA_VALUE_SHIFT,
 JERRY_STATIC_ASSERT (sizeof (ecma_stringbuilder_header_t) <= ECMA_ASCII_STRING_HEADER_SIZE,
                      ecma_stringbuilder_header_must_not_be_larger_than_ecma_ascii_string);
 
+JERRY_STATIC_ASSERT (ECMA_ROPE_STRING_LEAF_SIZE < ECMA_ROPE_STRING_MIN_SIZE,
+                     ecma_rope_string_leaves_must_not_be_ropes);
+
 /**
  * Convert a string to an unsigned 32 bit value if possible
  *
@@ -117,6 +120,137 @@ ecma_string_to_array_index (const lit_utf8_byte_t *string_p, /**< utf-8 string *
   return true;
 } /* ecma_string_to_array_index */
 
+/**
+ * Checks whether the string is a rope whose characters are not copied into a single buffer yet.
+ *
+ * @return true - if the string is an unflattened rope,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_string_is_unflattened_rope (const ecma_string_t *string_p) /**< ecma-string */
+{
+  return (!ECMA_IS_DIRECT_STRING (string_p)
+          && ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING
+          && ((const ecma_long_string_t *) string_p)->string_p == NULL);
+} /* ecma_string_is_unflattened_rope */
+
+/**
+ * Release the operands of a rope string.
+ *
+ * Note:
+ *   Ropes grow along their left operands, so the left operands which are
+ *   released as well are processed iteratively rather than recursively.
+ */
+static void
+ecma_rope_string_free_operands (ecma_rope_string_t *rope_p) /**< rope string */
+{
+  ecma_rope_string_t *current_p = rope_p;
+
+  while (true)
+  {
+    JERRY_ASSERT (!ecma_string_is_unflattened_rope (ecma_get_string_from_value (current_p->right)));
+
+    ecma_free_value (current_p->right);
+
+    ecma_value_t left = current_p->left;
+
+    if (current_p != rope_p)
+    {
+      ecma_dealloc_string_buffer ((ecma_string_t *) current_p, sizeof (ecma_rope_string_t));
+    }
+
+    ecma_string_t *left_p = ecma_get_string_from_value (left);
+
+    if (!ecma_string_is_unflattened_rope (left_p) || !ECMA_STRING_IS_REF_EQUALS_TO_ONE (left_p))
+    {
+      ecma_deref_ecma_string (left_p);
+      return;
+    }
+
+    current_p = (ecma_rope_string_t *) left_p;
+  }
+} /* ecma_rope_string_free_operands */
+
+/**
+ * Copy the characters of a rope operand before the end of a buffer.
+ *
+ * @return start of the copied characters
+ */
+static lit_utf8_byte_t *
+ecma_rope_string_copy_operand (ecma_value_t operand, /**< rope operand */
+                               lit_utf8_byte_t *buffer_end_p) /**< end of the destination area */
+{
+  lit_utf8_size_t size;
+  uint8_t flags = ECMA_STRING_FLAG_EMPTY;
+  lit_utf8_byte_t uint32_to_string_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+
+  const lit_utf8_byte_t *chars_p =
+    ecma_string_get_chars (ecma_get_string_from_value (operand), &size, NULL, uint32_to_string_buffer, &flags);
+
+  JERRY_ASSERT (!(flags & ECMA_STRING_FLAG_MUST_BE_FREED));
+
+  buffer_end_p -= size;
+  memcpy (buffer_end_p, chars_p, size);
+  return buffer_end_p;
+} /* ecma_rope_string_copy_operand */
+
+/**
+ * Copy the characters of a rope string into a single buffer and release its operands.
+ *
+ * @return characters of the rope string
+ */
+static const lit_utf8_byte_t *JERRY_ATTR_NOINLINE
+ecma_rope_string_flatten (ecma_rope_string_t *rope_p) /**< rope string */
+{
+  JERRY_ASSERT (rope_p->header.string_p == NULL);
+
+  lit_utf8_size_t size = rope_p->header.size;
+  lit_utf8_byte_t *buffer_p = (lit_utf8_byte_t *) ecma_alloc_string_buffer (size);
+  lit_utf8_byte_t *buffer_end_p = buffer_p + size;
+  const ecma_rope_string_t *current_p = rope_p;
+
+  while (true)
+  {
+    buffer_end_p = ecma_rope_string_copy_operand (current_p->right, buffer_end_p);
+
+    const ecma_string_t *left_p = ecma_get_string_from_value (current_p->left);
+
+    if (!ecma_string_is_unflattened_rope (left_p))
+    {
+      buffer_end_p = ecma_rope_string_copy_operand (current_p->left, buffer_end_p);
+      break;
+    }
+
+    current_p = (const ecma_rope_string_t *) left_p;
+  }
+
+  JERRY_ASSERT (buffer_end_p == buffer_p);
+
+  ecma_rope_string_free_operands (rope_p);
+  rope_p->header.string_p = buffer_p;
+  return buffer_p;
+} /* ecma_rope_string_flatten */
+
+/**
+ * Returns the characters of a rope string, the rope is flattened if needed.
+ *
+ * @return characters of the rope string
+ */
+static inline const lit_utf8_byte_t *JERRY_ATTR_ALWAYS_INLINE
+ecma_rope_string_get_chars (const ecma_string_t *string_p) /**< rope string */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING);
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+  if (JERRY_UNLIKELY (rope_p->header.string_p == NULL))
+  {
+    return ecma_rope_string_flatten (rope_p);
+  }
+
+  return rope_p->header.string_p;
+} /* ecma_rope_string_get_chars */
+
 /**
  * Returns the characters and size of a string.
  *
@@ -169,6 +303,11 @@ ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
       *size_p = ECMA_ASCII_STRING_GET_SIZE (string_p);
       return ECMA_ASCII_STRING_GET_BUFFER (string_p);
     }
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      *size_p = ((ecma_long_string_t *) string_p)->size;
+      return ecma_rope_string_get_chars (string_p);
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -701,6 +840,102 @@ ecma_get_internal_string (lit_magic_string_id_t id) /**< identifier of magic str
   return (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_SPECIAL, (uintptr_t) id);
 } /* ecma_get_internal_string */
 
+/**
+ * Checks whether concatenating a string with another string should create a rope string.
+ *
+ * @return true - if a rope string should be created,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_string_concat_creates_rope (const ecma_string_t *string1_p) /**< base ecma-string */
+{
+  /* Ropes are never equal to external magic strings, since those must be represented by magic string ids. */
+  return (!ECMA_IS_DIRECT_STRING (string1_p) && ecma_string_get_size (string1_p) >= ECMA_ROPE_STRING_MIN_SIZE
+          && lit_get_magic_string_ex_count () == 0);
+} /* ecma_string_concat_creates_rope */
+
+/**
+ * Create a rope string which represents the concatenation of two strings
+ * without copying the characters of the first string.
+ *
+ * Note:
+ *   The string1_p argument is freed. If it needs to be preserved,
+ *   call ecma_ref_ecma_string with string1_p before the call.
+ *
+ * @return rope string
+ */
+static ecma_string_t *
+ecma_concat_to_rope_string (ecma_string_t *string1_p, /**< base ecma-string */
+                            ecma_string_t *string2_p, /**< ecma-string of cesu8_string2_p or NULL */
+                            const lit_utf8_byte_t *cesu8_string2_p, /**< characters to be appended */
+                            lit_utf8_size_t cesu8_string2_size, /**< byte size of cesu8_string2_p */
+                            lit_utf8_size_t cesu8_string2_length) /**< character length of cesu8_string2_p */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING
+                || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+                || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE_STRING);
+  JERRY_ASSERT (string2_p == NULL || !ecma_string_is_unflattened_rope (string2_p));
+
+  lit_utf8_size_t cesu8_string1_size = ecma_string_get_size (string1_p);
+  lit_utf8_size_t new_size = cesu8_string1_size + cesu8_string2_size;
+
+  /* Poor man's carry flag check: it is impossible to allocate this large string. */
+  if (new_size < (cesu8_string1_size | cesu8_string2_size))
+  {
+    jerry_fatal (JERRY_FATAL_OUT_OF_MEMORY);
+  }
+
+  lit_string_hash_t hash = lit_utf8_string_hash_combine (string1_p->u.hash, cesu8_string2_p, cesu8_string2_size);
+  lit_utf8_size_t new_length = ecma_string_get_length (string1_p) + cesu8_string2_length;
+  ecma_value_t left = ECMA_VALUE_EMPTY;
+  ecma_value_t right = ECMA_VALUE_EMPTY;
+
+  if (ecma_string_is_unflattened_rope (string1_p))
+  {
+    ecma_rope_string_t *rope1_p = (ecma_rope_string_t *) string1_p;
+    ecma_string_t *right1_p = ecma_get_string_from_value (rope1_p->right);
+
+    if (ecma_string_get_size (right1_p) + cesu8_string2_size <= ECMA_ROPE_STRING_LEAF_SIZE)
+    {
+      /* Short right operands are merged, so appending short strings
+       * repeatedly adds only one rope node for every leaf. */
+      ecma_ref_ecma_string (right1_p);
+      right1_p = ecma_append_chars_to_string (right1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+
+      left = ecma_copy_value (rope1_p->left);
+      right = ecma_make_string_value (right1_p);
+      ecma_deref_ecma_string (string1_p);
+    }
+  }
+
+  if (left == ECMA_VALUE_EMPTY)
+  {
+    if (string2_p != NULL)
+    {
+      ecma_ref_ecma_string (string2_p);
+    }
+    else
+    {
+      string2_p = ecma_new_ecma_string_from_utf8 (cesu8_string2_p, cesu8_string2_size);
+    }
+
+    left = ecma_make_string_value (string1_p);
+    right = ecma_make_string_value (string2_p);
+  }
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) ecma_alloc_string_buffer (sizeof (ecma_rope_string_t));
+
+  rope_p->header.header.refs_and_container = ECMA_STRING_CONTAINER_ROPE_STRING | ECMA_STRING_REF_ONE;
+  rope_p->header.header.u.hash = hash;
+  rope_p->header.string_p = NULL;
+  rope_p->header.size = new_size;
+  rope_p->header.length = new_length;
+  rope_p->left = left;
+  rope_p->right = right;
+
+  return (ecma_string_t *) rope_p;
+} /* ecma_concat_to_rope_string */
+
 /**
  * Append a cesu8 string after an ecma-string
  *
@@ -723,6 +958,11 @@ ecma_append_chars_to_string (ecma_string_t *string1_p, /**< base ecma-string */
     return ecma_new_ecma_string_from_utf8 (cesu8_string2_p, cesu8_string2_size);
   }
 
+  if (ecma_string_concat_creates_rope (string1_p))
+  {
+    return ecma_concat_to_rope_string (string1_p, NULL, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+  }
+
   lit_utf8_size_t cesu8_string1_size;
   lit_utf8_size_t cesu8_string1_length;
   uint8_t flags = ECMA_STRING_FLAG_IS_ASCII;
@@ -839,8 +1079,17 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
 
   JERRY_ASSERT (cesu8_string2_p != NULL);
 
-  ecma_string_t *result_p =
-    ecma_append_chars_to_string (string1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+  ecma_string_t *result_p;
+
+  if (ecma_string_concat_creates_rope (string1_p))
+  {
+    result_p =
+      ecma_concat_to_rope_string (string1_p, string2_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+  }
+  else
+  {
+    result_p = ecma_append_chars_to_string (string1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+  }
 
   JERRY_ASSERT (!(flags & ECMA_STRING_FLAG_MUST_BE_FREED));
 
@@ -990,6 +1239,22 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       ecma_dealloc_extended_string (symbol_p);
       return;
     }
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+      if (rope_p->header.string_p != NULL)
+      {
+        ecma_dealloc_string_buffer ((ecma_string_t *) rope_p->header.string_p, rope_p->header.size);
+      }
+      else
+      {
+        ecma_rope_string_free_operands (rope_p);
+      }
+
+      ecma_dealloc_string_buffer (string_p, sizeof (ecma_rope_string_t));
+      return;
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC
@@ -1327,6 +1592,14 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
         result_p = ECMA_ASCII_STRING_GET_BUFFER (string_p);
         break;
       }
+      case ECMA_STRING_CONTAINER_ROPE_STRING:
+      {
+        ecma_long_string_t *long_string_desc_p = (ecma_long_string_t *) string_p;
+        size = long_string_desc_p->size;
+        length = long_string_desc_p->length;
+        result_p = ecma_rope_string_get_chars (string_p);
+        break;
+      }
       case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
       {
         size = (lit_utf8_size_t) ecma_string_get_uint32_size (string_p->u.uint32_number);
@@ -1578,6 +1851,14 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
       size_and_length_p[1] = size_and_length_p[0];
       return ECMA_ASCII_STRING_GET_BUFFER (string_p);
     }
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
+      JERRY_ASSERT (long_string_p->string_p != NULL);
+      size_and_length_p[0] = long_string_p->size;
+      size_and_length_p[1] = long_string_p->length;
+      return long_string_p->string_p;
+    }
     default:
     {
       return NULL;
@@ -1585,6 +1866,101 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
   }
 } /* ecma_compare_get_string_chars */
 
+/**
+ * Iterator which visits the characters of a string backwards, one rope operand at a time
+ */
+typedef struct
+{
+  const ecma_string_t *string_p; /**< part of the string which is not visited yet (NULL if there is none) */
+  const lit_utf8_byte_t *chunk_p; /**< characters of the current operand */
+  lit_utf8_size_t chunk_size; /**< number of characters of the current operand which are not visited yet */
+  lit_utf8_byte_t uint32_to_string_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32]; /**< buffer for uint32 operands */
+} ecma_rope_string_iterator_t;
+
+/**
+ * Move a rope string iterator to the next (preceding) operand.
+ */
+static void
+ecma_rope_string_iterator_next (ecma_rope_string_iterator_t *iterator_p) /**< iterator */
+{
+  const ecma_string_t *string_p = iterator_p->string_p;
+
+  JERRY_ASSERT (string_p != NULL);
+
+  if (ecma_string_is_unflattened_rope (string_p))
+  {
+    const ecma_rope_string_t *rope_p = (const ecma_rope_string_t *) string_p;
+
+    string_p = ecma_get_string_from_value (rope_p->right);
+    iterator_p->string_p = ecma_get_string_from_value (rope_p->left);
+  }
+  else
+  {
+    iterator_p->string_p = NULL;
+  }
+
+  uint8_t flags = ECMA_STRING_FLAG_EMPTY;
+  iterator_p->chunk_p =
+    ecma_string_get_chars (string_p, &iterator_p->chunk_size, NULL, iterator_p->uint32_to_string_buffer, &flags);
+
+  JERRY_ASSERT (!(flags & ECMA_STRING_FLAG_MUST_BE_FREED));
+} /* ecma_rope_string_iterator_next */
+
+/**
+ * Compare two ecma-strings when at least one of them is an unflattened rope.
+ *
+ * Note:
+ *   Ropes are not flattened, so the comparison never allocates memory.
+ *
+ * @return true - if strings are equal;
+ *         false - otherwise
+ */
+static bool JERRY_ATTR_NOINLINE
+ecma_compare_rope_strings (const ecma_string_t *string1_p, /**< ecma-string */
+                           const ecma_string_t *string2_p) /**< ecma-string */
+{
+  lit_utf8_size_t size = ecma_string_get_size (string1_p);
+
+  if (size != ecma_string_get_size (string2_p)
+      || ecma_string_get_length (string1_p) != ecma_string_get_length (string2_p))
+  {
+    return false;
+  }
+
+  ecma_rope_string_iterator_t iterator1, iterator2;
+  iterator1.string_p = string1_p;
+  iterator1.chunk_size = 0;
+  iterator2.string_p = string2_p;
+  iterator2.chunk_size = 0;
+
+  while (size > 0)
+  {
+    while (iterator1.chunk_size == 0)
+    {
+      ecma_rope_string_iterator_next (&iterator1);
+    }
+
+    while (iterator2.chunk_size == 0)
+    {
+      ecma_rope_string_iterator_next (&iterator2);
+    }
+
+    lit_utf8_size_t compare_size = JERRY_MIN (iterator1.chunk_size, iterator2.chunk_size);
+
+    iterator1.chunk_size -= compare_size;
+    iterator2.chunk_size -= compare_size;
+
+    if (memcmp (iterator1.chunk_p + iterator1.chunk_size, iterator2.chunk_p + iterator2.chunk_size, compare_size))
+    {
+      return false;
+    }
+
+    size -= compare_size;
+  }
+
+  return true;
+} /* ecma_compare_rope_strings */
+
 /**
  * Long path part of ecma-string to ecma-string comparison routine
  *
@@ -1598,6 +1974,11 @@ static bool JERRY_ATTR_NOINLINE
 ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /**< ecma-string */
                                     const ecma_string_t *string2_p) /**< ecma-string */
 {
+  if (JERRY_UNLIKELY (ecma_string_is_unflattened_rope (string1_p) || ecma_string_is_unflattened_rope (string2_p)))
+  {
+    return ecma_compare_rope_strings (string1_p, string2_p);
+  }
+
   const lit_utf8_byte_t *utf8_string1_p, *utf8_string2_p;
   lit_utf8_size_t string1_size_and_length[2] = { 0 };
   lit_utf8_size_t string2_size_and_length[2] = { 0 };
@@ -1862,7 +2243,8 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_short_string_t *) string_p)->length;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
   {
     return ((ecma_long_string_t *) string_p)->length;
   }
@@ -1910,7 +2292,8 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_length_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
     lit_utf8_size_t size = long_string_p->size;
@@ -1920,7 +2303,14 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
       return size;
     }
 
-    return lit_get_utf8_length_of_cesu8_string (long_string_p->string_p, size);
+    const lit_utf8_byte_t *chars_p = long_string_p->string_p;
+
+    if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
+    {
+      chars_p = ecma_rope_string_get_chars (string_p);
+    }
+
+    return lit_get_utf8_length_of_cesu8_string (chars_p, size);
   }
 
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -1958,7 +2348,8 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_short_string_t *) string_p)->size;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
   {
     return ((ecma_long_string_t *) string_p)->size;
   }
@@ -2005,7 +2396,8 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_size_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
 
@@ -2014,7 +2406,14 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
       return long_string_p->size;
     }
 
-    return lit_get_utf8_size_of_cesu8_string (long_string_p->string_p, long_string_p->size);
+    const lit_utf8_byte_t *chars_p = long_string_p->string_p;
+
+    if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
+    {
+      chars_p = ecma_rope_string_get_chars (string_p);
+    }
+
+    return lit_get_utf8_size_of_cesu8_string (chars_p, long_string_p->size);
   }
 
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -2105,6 +2504,11 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
 
       return lit_utf8_string_code_unit_at (data_p, size, index);
     }
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_get_chars (string_p);
+      /* FALLTHRU */
+    }
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -21,6 +21,7 @@
 #include "ecma-helpers-number.h"
 #include "ecma-helpers.h"
 
+#include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "jrt.h"
 #include "vm-defines.h"
@@ -924,16 +925,22 @@ ecma_fast_copy_value (ecma_value_t value) /**< value description */
 /**
  * Copy the ecma value if not an object
  *
+ * Note:
+ *      objects are not referenced, since the copy is stored in the heap
+ *
  * @return copy of the given value
  */
 extern inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
-ecma_copy_value_if_not_object (ecma_value_t value) /**< value description */
+ecma_copy_value_if_not_object (ecma_object_t *holder_p, /**< object which holds the copy,
+                                                         *   NULL if the copy is stored outside of the objects */
+                               ecma_value_t value) /**< value description */
 {
   if (!ecma_is_value_object (value))
   {
     return ecma_copy_value (value);
   }
 
+  ecma_gc_write_barrier (holder_p, ecma_get_object_from_value (value));
   return value;
 } /* ecma_copy_value_if_not_object */
 
@@ -968,7 +975,8 @@ ecma_deref_if_object (ecma_value_t value) /**< value description */
  *      value previously stored in the property is freed
  */
 void
-ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
+ecma_value_assign_value (ecma_object_t *holder_p, /**< object which holds the ecma value */
+                         ecma_value_t *value_p, /**< [in, out] ecma value */
                          ecma_value_t ecma_value) /**< value to assign */
 {
   JERRY_STATIC_ASSERT (ECMA_TYPE_DIRECT == 0, ecma_type_direct_must_be_zero_for_the_next_check);
@@ -992,7 +1000,7 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
   else
   {
     ecma_free_value_if_not_object (*value_p);
-    *value_p = ecma_copy_value_if_not_object (ecma_value);
+    *value_p = ecma_copy_value_if_not_object (holder_p, ecma_value);
   }
 } /* ecma_value_assign_value */
 
@@ -106,6 +106,11 @@ ecma_create_object (ecma_object_t *prototype_object_p, /**< pointer to prototybe
 
   ECMA_SET_POINTER (new_object_p->u2.prototype_cp, prototype_object_p);
 
+  if (prototype_object_p != NULL)
+  {
+    ecma_gc_write_barrier (new_object_p, prototype_object_p);
+  }
+
   return new_object_p;
 } /* ecma_create_object */
 
@@ -132,6 +137,11 @@ ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p) /**< outer
 
   ECMA_SET_POINTER (new_lexical_environment_p->u2.outer_reference_cp, outer_lexical_environment_p);
 
+  if (outer_lexical_environment_p != NULL)
+  {
+    ecma_gc_write_barrier (new_lexical_environment_p, outer_lexical_environment_p);
+  }
+
   return new_lexical_environment_p;
 } /* ecma_create_decl_lex_env */
 
@@ -158,9 +168,15 @@ ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p, /**< out
   ecma_init_gc_info (new_lexical_environment_p);
 
   ECMA_SET_NON_NULL_POINTER (new_lexical_environment_p->u1.bound_object_cp, binding_obj_p);
+  ecma_gc_write_barrier (new_lexical_environment_p, binding_obj_p);
 
   ECMA_SET_POINTER (new_lexical_environment_p->u2.outer_reference_cp, outer_lexical_environment_p);
 
+  if (outer_lexical_environment_p != NULL)
+  {
+    ecma_gc_write_barrier (new_lexical_environment_p, outer_lexical_environment_p);
+  }
+
   return new_lexical_environment_p;
 } /* ecma_create_object_lex_env */
 
@@ -195,6 +211,11 @@ ecma_create_lex_env_class (ecma_object_t *outer_lexical_environment_p, /**< oute
 
   ECMA_SET_POINTER (new_lexical_environment_p->u2.outer_reference_cp, outer_lexical_environment_p);
 
+  if (outer_lexical_environment_p != NULL)
+  {
+    ecma_gc_write_barrier (new_lexical_environment_p, outer_lexical_environment_p);
+  }
+
   return new_lexical_environment_p;
 } /* ecma_create_lex_env_class */
 
@@ -363,7 +384,7 @@ ecma_clone_decl_lexical_environment (ecma_object_t *lex_env_p, /**< declarative
 
         if (copy_values)
         {
-          property_value_p->value = ecma_copy_value_if_not_object (prop_pair_p->values[i].value);
+          property_value_p->value = ecma_copy_value_if_not_object (new_lex_env_p, prop_pair_p->values[i].value);
         }
         else
         {
@@ -569,6 +590,16 @@ ecma_create_named_accessor_property (ecma_object_t *object_p, /**< object */
   ECMA_SET_POINTER (value.getter_setter_pair.setter_cp, set_p);
 #endif /* JERRY_CPOINTER_32_BIT */
 
+  if (get_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, get_p);
+  }
+
+  if (set_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, set_p);
+  }
+
   return ecma_create_property (object_p, name_p, type_and_flags, value, out_prop_p);
 } /* ecma_create_named_accessor_property */
 
@@ -925,7 +956,7 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
 {
   ecma_assert_object_contains_the_property (obj_p, prop_value_p, true);
 
-  ecma_value_assign_value (&prop_value_p->value, value);
+  ecma_value_assign_value (obj_p, &prop_value_p->value, value);
 } /* ecma_named_data_property_assign_value */
 
 /**
@@ -960,6 +991,11 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
 #else /* !JERRY_CPOINTER_32_BIT */
   ECMA_SET_POINTER (prop_value_p->getter_setter_pair.getter_cp, getter_p);
 #endif /* JERRY_CPOINTER_32_BIT */
+
+  if (getter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, getter_p);
+  }
 } /* ecma_set_named_accessor_property_getter */
 
 /**
@@ -979,6 +1015,11 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
 #else /* !JERRY_CPOINTER_32_BIT */
   ECMA_SET_POINTER (prop_value_p->getter_setter_pair.setter_cp, setter_p);
 #endif /* JERRY_CPOINTER_32_BIT */
+
+  if (setter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, setter_p);
+  }
 } /* ecma_set_named_accessor_property_setter */
 
 #if JERRY_MODULE_SYSTEM
@@ -95,6 +95,7 @@ ecma_builtin_aggregate_error_dispatch_construct (const ecma_value_t *arguments_l
   {
     ecma_object_t *object_p = ecma_get_object_from_value (result);
     ECMA_SET_NON_NULL_POINTER (object_p->u2.prototype_cp, proto_p);
+    ecma_gc_write_barrier (object_p, proto_p);
   }
 
   ecma_deref_object (proto_p);
@@ -444,7 +444,7 @@ ecma_builtin_array_prototype_object_push (const ecma_value_t *argument_list_p, /
 
     for (uint32_t index = 0; index < arguments_number; index++)
     {
-      buffer_p[index] = ecma_copy_value_if_not_object (argument_list_p[index]);
+      buffer_p[index] = ecma_copy_value_if_not_object (obj_p, argument_list_p[index]);
     }
 
     ext_obj_p->u.array.length_prop_and_hole_count -= ECMA_FAST_ARRAY_HOLE_ONE * arguments_number;
@@ -845,7 +845,7 @@ ecma_builtin_array_prototype_object_slice (ecma_value_t arg1, /**< start */
       for (uint32_t k = (uint32_t) start; k < (uint32_t) end; k++, n++)
       {
         ecma_free_value_if_not_object (to_buffer_p[n]);
-        to_buffer_p[n] = ecma_copy_value_if_not_object (from_buffer_p[k]);
+        to_buffer_p[n] = ecma_copy_value_if_not_object (new_array_p, from_buffer_p[k]);
       }
 
       ext_to_obj_p->u.array.length_prop_and_hole_count &= ECMA_FAST_ARRAY_HOLE_ONE - 1;
@@ -1425,7 +1425,7 @@ ecma_builtin_array_prototype_object_unshift (const ecma_value_t args[], /**< arg
 
       while (index < args_number)
       {
-        buffer_p[index] = ecma_copy_value_if_not_object (args[index]);
+        buffer_p[index] = ecma_copy_value_if_not_object (obj_p, args[index]);
         index++;
       }
 
@@ -2189,7 +2189,7 @@ ecma_builtin_array_prototype_fill (ecma_value_t value, /**< value */
       while (k < final)
       {
         ecma_free_value_if_not_object (buffer_p[k]);
-        buffer_p[k] = ecma_copy_value_if_not_object (value);
+        buffer_p[k] = ecma_copy_value_if_not_object (obj_p, value);
         k++;
       }
 
@@ -2383,7 +2383,7 @@ ecma_builtin_array_prototype_object_copy_within (const ecma_value_t args[], /**<
 
         for (; count > 0; count--)
         {
-          ecma_value_t copy_value = ecma_copy_value_if_not_object (buffer_p[start]);
+          ecma_value_t copy_value = ecma_copy_value_if_not_object (obj_p, buffer_p[start]);
 
           ecma_free_value_if_not_object (buffer_p[target]);
 
@@ -513,6 +513,7 @@ ecma_builtin_array_dispatch_construct (const ecma_value_t *arguments_list_p, /**
 
   ecma_object_t *object_p = ecma_get_object_from_value (result);
   ECMA_SET_NON_NULL_POINTER (object_p->u2.prototype_cp, proto_p);
+  ecma_gc_write_barrier (object_p, proto_p);
   ecma_deref_object (proto_p);
   return result;
 } /* ecma_builtin_array_dispatch_construct */
@@ -346,12 +346,14 @@ ecma_builtin_function_prototype_object_bind (ecma_object_t *this_arg_obj_p, /**<
     /* 8. */
     bound_func_p = (ecma_bound_function_t *) function_p;
     ECMA_SET_NON_NULL_POINTER_TAG (bound_func_p->header.u.bound_function.target_function, this_arg_obj_p, 0);
+    ecma_gc_write_barrier (function_p, this_arg_obj_p);
 
     bound_func_p->header.u.bound_function.args_len_or_this = ECMA_VALUE_UNDEFINED;
 
     if (arguments_number != 0)
     {
-      bound_func_p->header.u.bound_function.args_len_or_this = ecma_copy_value_if_not_object (arguments_list_p[0]);
+      bound_func_p->header.u.bound_function.args_len_or_this =
+        ecma_copy_value_if_not_object (function_p, arguments_list_p[0]);
     }
   }
   else
@@ -365,6 +367,7 @@ ecma_builtin_function_prototype_object_bind (ecma_object_t *this_arg_obj_p, /**<
     /* 8. */
     bound_func_p = (ecma_bound_function_t *) function_p;
     ECMA_SET_NON_NULL_POINTER_TAG (bound_func_p->header.u.bound_function.target_function, this_arg_obj_p, 0);
+    ecma_gc_write_barrier (function_p, this_arg_obj_p);
 
     /* NOTE: This solution provides temporary false data about the object's size
        but prevents GC from freeing it until it's not fully initialized. */
@@ -373,7 +376,7 @@ ecma_builtin_function_prototype_object_bind (ecma_object_t *this_arg_obj_p, /**<
 
     for (uint32_t i = 0; i < arguments_number; i++)
     {
-      *args_p++ = ecma_copy_value_if_not_object (arguments_list_p[i]);
+      *args_p++ = ecma_copy_value_if_not_object (function_p, arguments_list_p[i]);
     }
 
     ecma_value_t args_len_or_this = ecma_make_integer_value ((ecma_integer_value_t) arguments_number);
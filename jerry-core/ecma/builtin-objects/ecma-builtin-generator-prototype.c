@@ -181,9 +181,12 @@ ecma_builtin_generator_prototype_object_do (vm_executable_object_t *generator_ob
         ecma_deref_object (ecma_get_object_from_value (iterator));
         generator_object_p->extended_object.u.cls.u2.executable_obj_flags |= ECMA_EXECUTABLE_OBJECT_DO_AWAIT_OR_YIELD;
         generator_object_p->iterator = iterator;
+        ecma_gc_write_barrier_value ((ecma_object_t *) generator_object_p, iterator);
 
         if (generator_object_p->frame_ctx.stack_top_p[0] != ECMA_VALUE_UNDEFINED)
         {
+          ecma_gc_write_barrier_value ((ecma_object_t *) generator_object_p,
+                                       generator_object_p->frame_ctx.stack_top_p[0]);
           ecma_deref_object (ecma_get_object_from_value (generator_object_p->frame_ctx.stack_top_p[0]));
         }
 
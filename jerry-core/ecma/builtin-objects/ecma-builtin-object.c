@@ -782,6 +782,7 @@ ecma_builtin_object_object_get_own_property_descriptors (ecma_object_t *obj_p) /
                                                                         ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                                         NULL);
       value_p->value = ecma_make_object_value (desc_obj_p);
+      ecma_gc_write_barrier (descriptors_p, desc_obj_p);
 
       ecma_deref_object (desc_obj_p);
       ecma_free_property_descriptor (&prop_desc);
@@ -1250,7 +1251,7 @@ ecma_builtin_object_from_entries (ecma_value_t iterator) /**< object's iterator
       ecma_property_value_t *prop;
       prop =
         ecma_create_named_data_property (obj_p, property_key, ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE, NULL);
-      prop->value = ecma_copy_value_if_not_object (value);
+      prop->value = ecma_copy_value_if_not_object (obj_p, value);
     }
     else
     {
@@ -463,6 +463,7 @@ ecma_instantiate_builtin (ecma_global_object_t *global_object_p, /**< global obj
   }
 
   ECMA_SET_NON_NULL_POINTER (builtin_objects[obj_builtin_id], obj_p);
+  ecma_gc_write_barrier ((ecma_object_t *) global_object_p, obj_p);
   ecma_deref_object (obj_p);
   return obj_p;
 } /* ecma_instantiate_builtin */
@@ -523,6 +524,7 @@ ecma_builtin_create_global_object (void)
   ECMA_SET_NON_NULL_POINTER (global_object_p->global_env_cp, global_lex_env_p);
   global_object_p->global_scope_cp = global_object_p->global_env_cp;
 
+  ecma_gc_write_barrier ((ecma_object_t *) global_object_p, global_lex_env_p);
   ecma_deref_object (global_lex_env_p);
 
   ecma_object_t *prototype_object_p;
@@ -531,6 +533,8 @@ ecma_builtin_create_global_object (void)
 
   ECMA_SET_NON_NULL_POINTER (object_p->u2.prototype_cp, prototype_object_p);
 
+  ecma_gc_write_barrier (object_p, prototype_object_p);
+
   return global_object_p;
 } /* ecma_builtin_create_global_object */
 
@@ -1117,6 +1121,7 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
     ecma_property_value_t *prop_value_p =
       ecma_create_named_data_property (object_p, property_name_p, curr_property_p->attributes, &prop_p);
     prop_value_p->value = value;
+    ecma_gc_write_barrier_value (object_p, value);
 
     /* Reference count of objects must be decreased. */
     ecma_deref_if_object (value);
@@ -85,7 +85,7 @@ ecma_op_create_arguments_object (vm_frame_ctx_shared_args_t *shared_p, /**< shar
 
   for (uint32_t i = 0; i < shared_p->arg_list_len; i++)
   {
-    argv_p[i] = ecma_copy_value_if_not_object (shared_p->arg_list_p[i]);
+    argv_p[i] = ecma_copy_value_if_not_object (obj_p, shared_p->arg_list_p[i]);
   }
 
   for (uint32_t i = shared_p->arg_list_len; i < saved_arg_count; i++)
@@ -307,6 +307,7 @@ ecma_op_arguments_object_try_to_lazy_instantiate_property (ecma_object_t *object
 
     prop_value_p->value = ecma_op_object_get_by_magic_id (ecma_builtin_get (ECMA_BUILTIN_ID_INTRINSIC_OBJECT),
                                                           LIT_INTERNAL_MAGIC_STRING_ARRAY_PROTOTYPE_VALUES);
+    ecma_gc_write_barrier_value (object_p, prop_value_p->value);
 
     JERRY_ASSERT (ecma_is_value_object (prop_value_p->value));
     ecma_deref_object (ecma_get_object_from_value (prop_value_p->value));
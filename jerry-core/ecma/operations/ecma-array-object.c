@@ -191,7 +191,7 @@ ecma_op_new_array_object_from_buffer (const ecma_value_t *args_p, /**< array ele
     for (uint32_t i = 0; i < length; i++)
     {
       JERRY_ASSERT (!ecma_is_value_array_hole (args_p[i]));
-      values_p[i] = ecma_copy_value_if_not_object (args_p[i]);
+      values_p[i] = ecma_copy_value_if_not_object (object_p, args_p[i]);
     }
 
     for (uint32_t i = length; i < aligned_length; i++)
@@ -212,7 +212,7 @@ ecma_op_new_array_object_from_buffer (const ecma_value_t *args_p, /**< array ele
       prop_value_p =
         ecma_create_named_data_property (object_p, prop_name_p, ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE, NULL);
       ecma_deref_ecma_string (prop_name_p);
-      prop_value_p->value = ecma_copy_value_if_not_object (args_p[i]);
+      prop_value_p->value = ecma_copy_value_if_not_object (object_p, args_p[i]);
     }
   }
 
@@ -372,7 +372,7 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
       ecma_free_value_if_not_object (values_p[index]);
     }
 
-    values_p[index] = ecma_copy_value_if_not_object (value);
+    values_p[index] = ecma_copy_value_if_not_object (object_p, value);
 
     return true;
   }
@@ -409,7 +409,7 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
     ext_obj_p->u.array.length_prop_and_hole_count -= ECMA_FAST_ARRAY_HOLE_ONE;
   }
 
-  values_p[index] = ecma_copy_value_if_not_object (value);
+  values_p[index] = ecma_copy_value_if_not_object (object_p, value);
 
   return true;
 } /* ecma_fast_array_set_property */
@@ -299,6 +299,7 @@ ecma_op_create_arraybuffer_object (const ecma_value_t *arguments_list_p, /**< li
 
   ecma_object_t *array_buffer = ecma_arraybuffer_new_object (length_uint32);
   ECMA_SET_NON_NULL_POINTER (array_buffer->u2.prototype_cp, proto_p);
+  ecma_gc_write_barrier (array_buffer, proto_p);
   ecma_deref_object (proto_p);
 
   return ecma_make_object_value (array_buffer);
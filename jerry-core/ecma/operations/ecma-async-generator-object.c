@@ -53,11 +53,12 @@ ecma_async_generator_enqueue (vm_executable_object_t *async_generator_object_p,
   ecma_async_generator_task_t *task_p = jmem_heap_alloc_block (sizeof (ecma_async_generator_task_t));
 
   ECMA_SET_INTERNAL_VALUE_ANY_POINTER (task_p->next, NULL);
-  task_p->operation_value = ecma_copy_value_if_not_object (value);
+  task_p->operation_value = ecma_copy_value_if_not_object ((ecma_object_t *) async_generator_object_p, value);
   task_p->operation_type = (uint8_t) operation;
 
   ecma_value_t result = ecma_op_create_promise_object (ECMA_VALUE_EMPTY, ECMA_VALUE_UNDEFINED, NULL);
   task_p->promise = result;
+  ecma_gc_write_barrier_value ((ecma_object_t *) async_generator_object_p, result);
 
   ecma_value_t head = async_generator_object_p->extended_object.u.cls.u3.head;
 
@@ -16,6 +16,7 @@
 
 #include "ecma-alloc.h"
 #include "ecma-array-object.h"
+#include "ecma-big-uint.h"
 #include "ecma-builtin-helpers.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
@@ -37,12 +38,18 @@
  * @{
  */
 
+/**
+ * Get the slots of a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_SLOTS(index_p) ((uint32_t *) ((index_p) + 1))
+
 /**
  * Create a new internal buffer.
  *
  * Note:
  *   The first element of the collection tracks the size of the buffer.
  *   ECMA_VALUE_EMPTY values are not calculated into the size.
+ *   The second element of the collection is the hash index of the entries.
  *
  * @return pointer to the internal buffer
  */
@@ -50,16 +57,238 @@ static inline ecma_collection_t *
 ecma_op_create_internal_buffer (void)
 {
   ecma_collection_t *collection_p = ecma_new_collection ();
-  ecma_collection_push_back (collection_p, (ecma_value_t) 0);
+  ecma_value_t header[] = { (ecma_value_t) 0, (ecma_value_t) 0 };
+  ecma_collection_append (collection_p, header, ECMA_CONTAINER_HEADER_SIZE);
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (ECMA_CONTAINER_HASH_INDEX (collection_p), NULL);
 
   return collection_p;
 } /* ecma_op_create_internal_buffer */
 
+/**
+ * Calculate the hash of a key. Keys which are equal according to SameValueZero
+ * always have the same hash.
+ *
+ * @return hash of the key
+ */
+static uint32_t
+ecma_op_container_hash_key (ecma_value_t key_arg) /**< key argument */
+{
+  uint32_t hash;
+
+  if (ecma_is_value_string (key_arg))
+  {
+    hash = ecma_string_hash (ecma_get_string_from_value (key_arg));
+  }
+  else if (ecma_is_value_integer_number (key_arg))
+  {
+    hash = (uint32_t) ecma_get_integer_from_value (key_arg);
+  }
+  else if (ecma_is_value_float_number (key_arg))
+  {
+    ecma_number_t number = ecma_get_float_from_value (key_arg);
+
+    if (ecma_number_is_nan (number))
+    {
+      hash = UINT32_MAX;
+    }
+    else if (ECMA_IS_INTEGER_NUMBER (number) && number == (ecma_number_t) (ecma_integer_value_t) number)
+    {
+      /* Also converts -0 to 0. */
+      hash = (uint32_t) (ecma_integer_value_t) number;
+    }
+    else
+    {
+      uint32_t words[sizeof (ecma_number_t) / sizeof (uint32_t)];
+      memcpy (words, &number, sizeof (ecma_number_t));
+      hash = 0;
+
+      for (uint32_t i = 0; i < sizeof (ecma_number_t) / sizeof (uint32_t); i++)
+      {
+        hash ^= words[i];
+      }
+    }
+  }
+#if JERRY_BUILTIN_BIGINT
+  else if (ecma_is_value_bigint (key_arg) && key_arg != ECMA_BIGINT_ZERO)
+  {
+    ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (key_arg);
+    hash = bigint_p->u.bigint_sign_and_size ^ *ECMA_BIGINT_GET_DIGITS (bigint_p, 0);
+  }
+#endif /* JERRY_BUILTIN_BIGINT */
+  else
+  {
+    /* Objects, symbols and simple values are compared by identity. */
+    hash = (uint32_t) key_arg;
+  }
+
+  hash *= 0x9e3779b1u;
+  return hash ^ (hash >> 16);
+} /* ecma_op_container_hash_key */
+
+/**
+ * Release the hash index of the internal buffer.
+ */
+static void
+ecma_op_container_hash_index_free (ecma_collection_t *container_p) /**< internal container pointer */
+{
+  ecma_container_hash_index_t *index_p;
+  index_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_container_hash_index_t, ECMA_CONTAINER_HASH_INDEX (container_p));
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  size_t size = sizeof (ecma_container_hash_index_t) + (index_p->mask + 1) * sizeof (uint32_t);
+  jmem_heap_free_block (index_p, size);
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (ECMA_CONTAINER_HASH_INDEX (container_p), NULL);
+} /* ecma_op_container_hash_index_free */
+
+/**
+ * Store the offset of an entry into the first free slot of its probe sequence.
+ *
+ * Note:
+ *   the key of the entry must not be present in the hash index
+ */
+static void
+ecma_op_container_hash_index_put (ecma_container_hash_index_t *index_p, /**< hash index */
+                                  ecma_value_t *start_p, /**< first entry of the internal buffer */
+                                  uint32_t offset) /**< offset of the entry */
+{
+  uint32_t *slots_p = ECMA_CONTAINER_HASH_INDEX_SLOTS (index_p);
+  uint32_t mask = index_p->mask;
+  uint32_t slot_index = ecma_op_container_hash_key (start_p[offset]) & mask;
+
+  while (slots_p[slot_index] > ECMA_CONTAINER_HASH_SLOT_DELETED)
+  {
+    slot_index = (slot_index + 1) & mask;
+  }
+
+  if (slots_p[slot_index] == ECMA_CONTAINER_HASH_SLOT_EMPTY)
+  {
+    index_p->used_count++;
+  }
+
+  slots_p[slot_index] = offset + ECMA_CONTAINER_HASH_SLOT_OFFSET;
+} /* ecma_op_container_hash_index_put */
+
+/**
+ * Create a hash index for the entries of the internal buffer, replacing the previous one.
+ *
+ * Note:
+ *   when there is not enough memory, the container falls back to linear search
+ */
+static void
+ecma_op_container_hash_index_rebuild (ecma_collection_t *container_p, /**< internal container pointer */
+                                      uint8_t entry_size) /**< size of the entries */
+{
+  uint32_t slot_count = 2 * ECMA_CONTAINER_HASH_INDEX_MINIMUM_SIZE;
+
+  while (slot_count < 2 * (uint32_t) ECMA_CONTAINER_GET_SIZE (container_p))
+  {
+    slot_count <<= 1;
+  }
+
+  size_t size = sizeof (ecma_container_hash_index_t) + slot_count * sizeof (uint32_t);
+  ecma_container_hash_index_t *index_p = (ecma_container_hash_index_t *) jmem_heap_alloc_block_null_on_error (size);
+
+  /* The allocation above might trigger a garbage collection which removes
+   * entries from weak containers, so the old index is released afterwards. */
+  ecma_op_container_hash_index_free (container_p);
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  index_p->mask = slot_count - 1;
+  index_p->used_count = 0;
+  memset (ECMA_CONTAINER_HASH_INDEX_SLOTS (index_p), 0, slot_count * sizeof (uint32_t));
+
+  uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+
+  for (uint32_t i = 0; i < entry_count; i += entry_size)
+  {
+    if (!ecma_is_value_empty (start_p[i]))
+    {
+      ecma_op_container_hash_index_put (index_p, start_p, i);
+    }
+  }
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (ECMA_CONTAINER_HASH_INDEX (container_p), index_p);
+} /* ecma_op_container_hash_index_rebuild */
+
+/**
+ * Register the last entry of the internal buffer in the hash index.
+ */
+static void
+ecma_op_container_hash_index_insert (ecma_collection_t *container_p, /**< internal container pointer */
+                                     uint8_t entry_size) /**< size of the entries */
+{
+  ecma_container_hash_index_t *index_p;
+  index_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_container_hash_index_t, ECMA_CONTAINER_HASH_INDEX (container_p));
+
+  if (index_p == NULL)
+  {
+    uint32_t size = ECMA_CONTAINER_GET_SIZE (container_p);
+
+    /* Retrying only at powers of 2 avoids repeated allocation attempts under memory pressure. */
+    if (size >= ECMA_CONTAINER_HASH_INDEX_MINIMUM_SIZE && (size & (size - 1)) == 0)
+    {
+      ecma_op_container_hash_index_rebuild (container_p, entry_size);
+    }
+    return;
+  }
+
+  /* Keep the load factor (including deleted slots) below 3/4. */
+  if ((index_p->used_count + 1) * 4 > (index_p->mask + 1) * 3)
+  {
+    ecma_op_container_hash_index_rebuild (container_p, entry_size);
+    return;
+  }
+
+  ecma_op_container_hash_index_put (index_p,
+                                    ECMA_CONTAINER_START (container_p),
+                                    ECMA_CONTAINER_ENTRY_COUNT (container_p) - entry_size);
+} /* ecma_op_container_hash_index_insert */
+
+/**
+ * Remove an entry from the hash index. The key of the entry must still be valid.
+ */
+static void
+ecma_op_container_hash_index_remove (ecma_collection_t *container_p, /**< internal container pointer */
+                                     ecma_value_t *entry_p) /**< entry pointer */
+{
+  ecma_container_hash_index_t *index_p;
+  index_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_container_hash_index_t, ECMA_CONTAINER_HASH_INDEX (container_p));
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  uint32_t *slots_p = ECMA_CONTAINER_HASH_INDEX_SLOTS (index_p);
+  uint32_t mask = index_p->mask;
+  uint32_t slot_index = ecma_op_container_hash_key (*entry_p) & mask;
+  uint32_t slot_value = (uint32_t) (entry_p - ECMA_CONTAINER_START (container_p)) + ECMA_CONTAINER_HASH_SLOT_OFFSET;
+
+  while (slots_p[slot_index] != slot_value)
+  {
+    JERRY_ASSERT (slots_p[slot_index] != ECMA_CONTAINER_HASH_SLOT_EMPTY);
+    slot_index = (slot_index + 1) & mask;
+  }
+
+  slots_p[slot_index] = ECMA_CONTAINER_HASH_SLOT_DELETED;
+} /* ecma_op_container_hash_index_remove */
+
 /**
  * Append values to the internal buffer.
  */
 static void
-ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal container pointer */
+ecma_op_internal_buffer_append (ecma_object_t *object_p, /**< container object */
+                                ecma_collection_t *container_p, /**< internal container pointer */
                                 ecma_value_t key_arg, /**< key argument */
                                 ecma_value_t value_arg, /**< value argument */
                                 lit_magic_string_id_t lit_id) /**< class id */
@@ -68,22 +297,25 @@ ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal co
 
   if (lit_id == LIT_MAGIC_STRING_WEAKMAP_UL || lit_id == LIT_MAGIC_STRING_MAP_UL)
   {
-    ecma_value_t values[] = { ecma_copy_value_if_not_object (key_arg), ecma_copy_value_if_not_object (value_arg) };
+    ecma_value_t values[] = { ecma_copy_value_if_not_object (object_p, key_arg),
+                              ecma_copy_value_if_not_object (object_p, value_arg) };
     ecma_collection_append (container_p, values, 2);
   }
   else
   {
-    ecma_collection_push_back (container_p, ecma_copy_value_if_not_object (key_arg));
+    ecma_collection_push_back (container_p, ecma_copy_value_if_not_object (object_p, key_arg));
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, ECMA_CONTAINER_GET_SIZE (container_p) + 1);
+  ecma_op_container_hash_index_insert (container_p, ecma_op_container_entry_size (lit_id));
 } /* ecma_op_internal_buffer_append */
 
 /**
  * Update the value of a given entry.
  */
 static inline void
-ecma_op_internal_buffer_update (ecma_value_t *entry_p, /**< entry pointer */
+ecma_op_internal_buffer_update (ecma_object_t *object_p, /**< container object */
+                                ecma_value_t *entry_p, /**< entry pointer */
                                 ecma_value_t value_arg, /**< value argument */
                                 lit_magic_string_id_t lit_id) /**< class id */
 {
@@ -93,7 +325,7 @@ ecma_op_internal_buffer_update (ecma_value_t *entry_p, /**< entry pointer */
   {
     ecma_free_value_if_not_object (((ecma_container_pair_t *) entry_p)->value);
 
-    ((ecma_container_pair_t *) entry_p)->value = ecma_copy_value_if_not_object (value_arg);
+    ((ecma_container_pair_t *) entry_p)->value = ecma_copy_value_if_not_object (object_p, value_arg);
   }
 } /* ecma_op_internal_buffer_update */
 
@@ -108,6 +340,8 @@ ecma_op_internal_buffer_delete (ecma_collection_t *container_p, /**< internal co
   JERRY_ASSERT (container_p != NULL);
   JERRY_ASSERT (entry_p != NULL);
 
+  ecma_op_container_hash_index_remove (container_p, &entry_p->key);
+
   ecma_free_value_if_not_object (entry_p->key);
   entry_p->key = ECMA_VALUE_EMPTY;
 
@@ -132,9 +366,36 @@ ecma_op_internal_buffer_find (ecma_collection_t *container_p, /**< internal cont
 {
   JERRY_ASSERT (container_p != NULL);
 
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+  ecma_container_hash_index_t *index_p;
+  index_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_container_hash_index_t, ECMA_CONTAINER_HASH_INDEX (container_p));
+
+  if (index_p != NULL)
+  {
+    uint32_t *slots_p = ECMA_CONTAINER_HASH_INDEX_SLOTS (index_p);
+    uint32_t mask = index_p->mask;
+    uint32_t slot_index = ecma_op_container_hash_key (key_arg) & mask;
+
+    while (slots_p[slot_index] != ECMA_CONTAINER_HASH_SLOT_EMPTY)
+    {
+      if (slots_p[slot_index] != ECMA_CONTAINER_HASH_SLOT_DELETED)
+      {
+        ecma_value_t *entry_p = start_p + (slots_p[slot_index] - ECMA_CONTAINER_HASH_SLOT_OFFSET);
+
+        if (ecma_op_same_value_zero (*entry_p, key_arg, false))
+        {
+          return entry_p;
+        }
+      }
+
+      slot_index = (slot_index + 1) & mask;
+    }
+
+    return NULL;
+  }
+
   uint8_t entry_size = ecma_op_container_entry_size (lit_id);
   uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
-  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
 
   for (uint32_t i = 0; i < entry_count; i += entry_size)
   {
@@ -339,6 +600,7 @@ ecma_op_container_free_entries (ecma_object_t *object_p) /**< collection object
     }
   }
 
+  ecma_op_container_hash_index_free (container_p);
   ECMA_CONTAINER_SET_SIZE (container_p, 0);
 } /* ecma_op_container_free_entries */
 
@@ -686,7 +948,11 @@ ecma_op_container_set (ecma_extended_object_t *map_object_p, /**< map object */
 
   if (entry_p == NULL)
   {
-    ecma_op_internal_buffer_append (container_p, ecma_op_container_set_noramlize_zero (key_arg), value_arg, lit_id);
+    ecma_op_internal_buffer_append ((ecma_object_t *) map_object_p,
+                                    container_p,
+                                    ecma_op_container_set_noramlize_zero (key_arg),
+                                    value_arg,
+                                    lit_id);
 
     if ((map_object_p->u.cls.u1.container_flags & ECMA_CONTAINER_FLAGS_WEAK) != 0)
     {
@@ -696,7 +962,10 @@ ecma_op_container_set (ecma_extended_object_t *map_object_p, /**< map object */
   }
   else
   {
-    ecma_op_internal_buffer_update (entry_p, ecma_op_container_set_noramlize_zero (value_arg), lit_id);
+    ecma_op_internal_buffer_update ((ecma_object_t *) map_object_p,
+                                    entry_p,
+                                    ecma_op_container_set_noramlize_zero (value_arg),
+                                    lit_id);
   }
 
   ecma_ref_object ((ecma_object_t *) map_object_p);
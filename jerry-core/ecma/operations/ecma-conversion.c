@@ -570,7 +570,7 @@ ecma_op_to_object (ecma_value_t value) /**< ecma value */
 
   ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
   ext_object_p->u.cls.type = class_type;
-  ext_object_p->u.cls.u3.value = ecma_copy_value_if_not_object (value);
+  ext_object_p->u.cls.u3.value = ecma_copy_value_if_not_object (object_p, value);
 
   return ecma_make_object_value (object_p);
 } /* ecma_op_to_object */
@@ -161,6 +161,7 @@ ecma_new_standard_error (jerry_error_t error_type, /**< native error type */
     ecma_value_t backtrace_value = vm_get_backtrace (0);
 
     prop_value_p->value = backtrace_value;
+    ecma_gc_write_barrier_value (error_object_p, backtrace_value);
     ecma_deref_object (ecma_get_object_from_value (backtrace_value));
 #endif /* JERRY_LINE_INFO */
   }
@@ -265,6 +266,7 @@ ecma_new_aggregate_error (ecma_value_t error_list_val, /**< errors list */
                                                     ECMA_PROPERTY_CONFIGURABLE_WRITABLE,
                                                     NULL);
     prop_value_p->value = error_list_arr;
+    ecma_gc_write_barrier_value (new_error_object_p, error_list_arr);
     ecma_free_value (error_list_arr);
   }
 
@@ -396,6 +396,7 @@ ecma_op_create_function_object (ecma_object_t *scope_p, /**< function's scope */
 
   /* 9. */
   ECMA_SET_NON_NULL_POINTER_TAG (ext_func_p->u.function.scope_cp, scope_p, 0);
+  ecma_gc_write_barrier (func_p, scope_p);
 
   /* 10., 11., 12. */
 
@@ -529,6 +530,7 @@ ecma_op_create_dynamic_function (const ecma_value_t *arguments_list_p, /**< argu
   ecma_object_t *func_obj_p = ecma_op_create_function_object (global_env_p, bytecode_p, fallback_proto);
 
   ECMA_SET_NON_NULL_POINTER (func_obj_p->u2.prototype_cp, proto);
+  ecma_gc_write_barrier (func_obj_p, proto);
   ecma_deref_object (proto);
 
   ecma_bytecode_deref (bytecode_p);
@@ -625,6 +627,7 @@ ecma_op_create_arrow_function_object (ecma_object_t *scope_p, /**< function's sc
   ecma_arrow_function_t *arrow_func_p = (ecma_arrow_function_t *) func_p;
 
   ECMA_SET_NON_NULL_POINTER_TAG (arrow_func_p->header.u.function.scope_cp, scope_p, 0);
+  ecma_gc_write_barrier (func_p, scope_p);
 
 #if JERRY_SNAPSHOT_EXEC
   if ((bytecode_data_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
@@ -641,12 +644,13 @@ ecma_op_create_arrow_function_object (ecma_object_t *scope_p, /**< function's sc
   }
 #endif /* JERRY_SNAPSHOT_EXEC */
 
-  arrow_func_p->this_binding = ecma_copy_value_if_not_object (this_binding);
+  arrow_func_p->this_binding = ecma_copy_value_if_not_object (func_p, this_binding);
   arrow_func_p->new_target = ECMA_VALUE_UNDEFINED;
 
   if (JERRY_CONTEXT (current_new_target_p) != NULL)
   {
     arrow_func_p->new_target = ecma_make_object_value (JERRY_CONTEXT (current_new_target_p));
+    ecma_gc_write_barrier (func_p, JERRY_CONTEXT (current_new_target_p));
   }
   return func_p;
 } /* ecma_op_create_arrow_function_object */
@@ -1906,6 +1910,7 @@ ecma_op_lazy_instantiate_prototype_object (ecma_object_t *object_p) /**< the fun
                                                             &prototype_prop_p);
 
   prototype_prop_value_p->value = ecma_make_object_value (proto_object_p);
+  ecma_gc_write_barrier (object_p, proto_object_p);
 
   ecma_deref_object (proto_object_p);
 
@@ -100,7 +100,7 @@ ecma_create_iter_result_object (ecma_value_t value, /**< value */
                                                   ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                   NULL);
 
-  prop_value_p->value = ecma_copy_value_if_not_object (value);
+  prop_value_p->value = ecma_copy_value_if_not_object (object_p, value);
 
   /* 4. */
   prop_value_p = ecma_create_named_data_property (object_p,
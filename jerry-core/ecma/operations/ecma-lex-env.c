@@ -84,6 +84,7 @@ ecma_create_global_lexical_block (ecma_object_t *global_object_p) /**< global ob
     ecma_object_t *global_scope_p = ecma_create_decl_lex_env (ecma_get_global_environment (global_object_p));
     global_scope_p->type_flags_refs |= ECMA_OBJECT_FLAG_BLOCK;
     ECMA_SET_NON_NULL_POINTER (real_global_object_p->global_scope_cp, global_scope_p);
+    ecma_gc_write_barrier ((ecma_object_t *) real_global_object_p, global_scope_p);
     ecma_deref_object (global_scope_p);
   }
 } /* ecma_create_global_lexical_block */
@@ -487,7 +488,7 @@ ecma_op_create_immutable_binding (ecma_object_t *lex_env_p, /**< lexical environ
    */
   ecma_property_value_t *prop_value_p = ecma_create_named_data_property (lex_env_p, name_p, ECMA_PROPERTY_FIXED, NULL);
 
-  prop_value_p->value = ecma_copy_value_if_not_object (value);
+  prop_value_p->value = ecma_copy_value_if_not_object (lex_env_p, value);
 } /* ecma_op_create_immutable_binding */
 
 /**
@@ -509,7 +510,7 @@ ecma_op_initialize_binding (ecma_object_t *lex_env_p, /**< lexical environment *
   ecma_property_value_t *prop_value_p = ECMA_PROPERTY_VALUE_PTR (prop_p);
   JERRY_ASSERT (prop_value_p->value == ECMA_VALUE_UNINITIALIZED);
 
-  prop_value_p->value = ecma_copy_value_if_not_object (value);
+  prop_value_p->value = ecma_copy_value_if_not_object (lex_env_p, value);
 } /* ecma_op_initialize_binding */
 
 /**
@@ -607,6 +608,7 @@ ecma_op_bind_this_value (ecma_environment_record_t *environment_record_p, /**< e
   JERRY_ASSERT (!ecma_op_this_binding_is_initialized (environment_record_p));
 
   environment_record_p->this_binding = this_binding;
+  ecma_gc_write_barrier_value (NULL, this_binding);
 } /* ecma_op_bind_this_value */
 
 /**
@@ -404,7 +404,7 @@ ecma_op_general_object_define_own_property (ecma_object_t *object_p, /**< the ob
       JERRY_ASSERT ((property_desc_p->flags & JERRY_PROP_IS_VALUE_DEFINED)
                     || ecma_is_value_undefined (property_desc_p->value));
 
-      new_prop_value_p->value = ecma_copy_value_if_not_object (property_desc_p->value);
+      new_prop_value_p->value = ecma_copy_value_if_not_object (object_p, property_desc_p->value);
     }
     else
     {
@@ -1234,7 +1234,7 @@ ecma_op_object_put_apply_receiver (ecma_value_t receiver, /**< receiver */
                                                       ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                       NULL);
   JERRY_ASSERT (ecma_is_value_undefined (new_prop_value_p->value));
-  new_prop_value_p->value = ecma_copy_value_if_not_object (value);
+  new_prop_value_p->value = ecma_copy_value_if_not_object (receiver_obj_p, value);
 
   return ECMA_VALUE_TRUE;
 } /* ecma_op_object_put_apply_receiver */
@@ -1593,7 +1593,7 @@ ecma_op_object_put_with_receiver (ecma_object_t *object_p, /**< the object */
                                                           NULL);
 
       JERRY_ASSERT (ecma_is_value_undefined (new_prop_value_p->value));
-      new_prop_value_p->value = ecma_copy_value_if_not_object (value);
+      new_prop_value_p->value = ecma_copy_value_if_not_object (object_p, value);
       return ECMA_VALUE_TRUE;
     }
   }
@@ -3231,6 +3231,11 @@ ecma_op_ordinary_object_set_prototype_of (ecma_object_t *obj_p, /**< base object
   /* 9. */
   ECMA_SET_POINTER (obj_p->u2.prototype_cp, new_proto_p);
 
+  if (new_proto_p != NULL)
+  {
+    ecma_gc_write_barrier (obj_p, new_proto_p);
+  }
+
   /* 10. */
   return ECMA_VALUE_TRUE;
 } /* ecma_op_ordinary_object_set_prototype_of */
@@ -204,7 +204,7 @@ ecma_reject_promise (ecma_value_t promise, /**< promise */
 #endif /* JERRY_PROMISE_CALLBACK */
 
   ecma_promise_set_state (obj_p, false);
-  ecma_promise_set_result (obj_p, ecma_copy_value_if_not_object (reason));
+  ecma_promise_set_result (obj_p, ecma_copy_value_if_not_object (obj_p, reason));
   ecma_promise_object_t *promise_p = (ecma_promise_object_t *) obj_p;
 
   /* GC can be triggered by ecma_new_collection so freeing the collection
@@ -287,7 +287,7 @@ ecma_fulfill_promise (ecma_value_t promise, /**< promise */
 #endif /* JERRY_PROMISE_CALLBACK */
 
   ecma_promise_set_state (obj_p, true);
-  ecma_promise_set_result (obj_p, ecma_copy_value_if_not_object (value));
+  ecma_promise_set_result (obj_p, ecma_copy_value_if_not_object (obj_p, value));
   ecma_promise_object_t *promise_p = (ecma_promise_object_t *) obj_p;
 
   /* GC can be triggered by ecma_new_collection so freeing the collection
@@ -629,7 +629,7 @@ ecma_promise_all_or_all_settled_handler_cb (ecma_object_t *function_obj_p, /**<
                                                     ecma_get_magic_string (data_propery_name),
                                                     ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                     NULL);
-    prop_value_p->value = ecma_copy_value_if_not_object (arg);
+    prop_value_p->value = ecma_copy_value_if_not_object (obj_p, arg);
 
     ecma_value_t obj_val = ecma_make_object_value (obj_p);
     /* 12. */
@@ -707,6 +707,9 @@ ecma_op_get_capabilities_executor_cb (ecma_object_t *function_obj_p, /**< functi
   /* 7. */
   capability_p->reject = (args_count > 1) ? args_p[1] : ECMA_VALUE_UNDEFINED;
 
+  ecma_gc_write_barrier_value (capability_obj_p, capability_p->resolve);
+  ecma_gc_write_barrier_value (capability_obj_p, capability_p->reject);
+
   /* 8. */
   return ECMA_VALUE_UNDEFINED;
 } /* ecma_op_get_capabilities_executor_cb */
@@ -995,7 +998,7 @@ ecma_promise_then_catch_finally_helper (ecma_object_t *function_obj_p, /**< func
   value_thunk_func_p = ecma_op_create_native_handler (id, sizeof (ecma_promise_value_thunk_t));
 
   ecma_promise_value_thunk_t *value_thunk_func_obj = (ecma_promise_value_thunk_t *) value_thunk_func_p;
-  value_thunk_func_obj->value = ecma_copy_value_if_not_object (arg);
+  value_thunk_func_obj->value = ecma_copy_value_if_not_object (value_thunk_func_p, arg);
 
   /* 9. */
   ecma_value_t value_thunk = ecma_make_object_value (value_thunk_func_p);
@@ -1142,6 +1145,7 @@ ecma_promise_async_then (ecma_value_t promise, /**< promise object */
     ECMA_SET_THIRD_BIT_TO_POINTER_TAG (executable_object_with_tag);
 
     ecma_collection_push_back (((ecma_promise_object_t *) promise_obj_p)->reactions, executable_object_with_tag);
+    ecma_gc_write_barrier_value (promise_obj_p, executable_object);
     return;
   }
 
@@ -1285,6 +1289,9 @@ ecma_promise_perform_then (ecma_value_t promise, /**< the promise which call 'th
     }
 
     ECMA_SET_NON_NULL_POINTER_TAG (reaction_values[0], result_capability_obj_p, tag);
+    ecma_gc_write_barrier (promise_obj_p, result_capability_obj_p);
+    ecma_gc_write_barrier_value (promise_obj_p, on_fulfilled);
+    ecma_gc_write_barrier_value (promise_obj_p, on_rejected);
 
     uint32_t value_count = (uint32_t) (reactions_p - reaction_values);
     ecma_collection_append (promise_p->reactions, reaction_values, value_count);
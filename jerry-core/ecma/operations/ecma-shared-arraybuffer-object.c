@@ -111,6 +111,7 @@ ecma_op_create_shared_arraybuffer_object (const ecma_value_t *arguments_list_p,
   uint32_t length_uint32 = ecma_number_to_uint32 (length_num);
   ecma_object_t *shared_array_buffer = ecma_shared_arraybuffer_new_object (length_uint32);
   ECMA_SET_NON_NULL_POINTER (shared_array_buffer->u2.prototype_cp, proto_p);
+  ecma_gc_write_barrier (shared_array_buffer, proto_p);
   ecma_deref_object (proto_p);
 
   return ecma_make_object_value (shared_array_buffer);
@@ -849,6 +849,8 @@ ecma_typedarray_create_object_with_length (uint32_t array_length, /**< length of
 
     ECMA_SET_NON_NULL_POINTER (new_arraybuffer_p->u2.prototype_cp, prototype_p);
 
+    ecma_gc_write_barrier (new_arraybuffer_p, prototype_p);
+
     ecma_deref_object (prototype_p);
 
     if (ecma_arraybuffer_is_detached (src_buffer_p))
@@ -54,6 +54,7 @@ void jerry_heap_free (void *mem_p, jerry_size_t size);
 
 bool jerry_heap_stats (jerry_heap_stats_t *out_stats_p);
 void jerry_heap_gc (jerry_gc_mode_t mode);
+bool jerry_heap_gc_step (uint32_t budget);
 
 bool jerry_foreach_live_object (jerry_foreach_live_object_cb_t callback, void *user_data);
 bool jerry_foreach_live_object_with_info (const jerry_object_native_info_t *native_info_p,
@@ -75,6 +75,13 @@
  */
 #define CONFIG_ECMA_GC_NEW_OBJECTS_FRACTION (16)
 
+#if JERRY_GC_GENERATIONAL
+/**
+ * Size of the bitmaps of the generations, which have one bit for each JMEM_ALIGNMENT sized unit of the heap.
+ */
+#define CONFIG_ECMA_GC_BITMAP_SIZE (CONFIG_MEM_HEAP_SIZE / (JMEM_ALIGNMENT * JERRY_BITSINBYTE))
+#endif /* JERRY_GC_GENERATIONAL */
+
 #if !JERRY_SYSTEM_ALLOCATOR
 /**
  * Heap structure
@@ -120,16 +127,24 @@ struct jerry_context_t
 
   ecma_global_object_t *global_object_p; /**< current global object */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< improves deallocation performance */
-  jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
+#if !JERRY_SYSTEM_ALLOCATOR
+  jmem_pools_chunk_t *jmem_free_chunk_p[JMEM_POOLS_SIZE_CLASS_COUNT]; /**< free chunk lists of each size class */
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
 #if JERRY_BUILTIN_REGEXP
   re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
 #endif /* JERRY_BUILTIN_REGEXP */
-#if JERRY_CPOINTER_32_BIT
-  jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
-#endif /* JERRY_CPOINTER_32_BIT */
   const lit_utf8_byte_t *const *lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
+  jmem_cpointer_t ecma_gc_black_cp; /**< marked objects of the current incremental GC cycle */
+  jmem_cpointer_t ecma_gc_black_end_cp; /**< last item of the ecma_gc_black_cp list */
+  jmem_cpointer_t ecma_gc_scan_cp; /**< first item of the ecma_gc_black_cp list whose references
+                                    *   are not visited yet */
+  jmem_cpointer_t ecma_gc_white_cp; /**< non-marked objects of the current incremental GC cycle */
+  jmem_cpointer_t ecma_gc_pass_cp; /**< last ecma_gc_white_cp item checked by the current marking pass */
+#if JERRY_GC_GENERATIONAL
+  jmem_cpointer_t ecma_gc_old_objects_cp; /**< first object of the old generation in the ecma_gc_objects_cp list */
+#endif /* JERRY_GC_GENERATIONAL */
   jmem_cpointer_t string_list_first_cp; /**< first item of the literal string list */
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
   jmem_cpointer_t number_list_first_cp; /**< first item of the literal number list */
@@ -158,6 +173,9 @@ struct jerry_context_t
   jerry_error_object_created_cb_t error_object_created_callback_p; /**< decorator callback for Error objects */
   size_t ecma_gc_objects_number; /**< number of currently allocated objects */
   size_t ecma_gc_new_objects; /**< number of newly allocated objects since last GC session */
+#if JERRY_GC_GENERATIONAL
+  size_t ecma_gc_old_objects_number; /**< number of objects after the last full GC session */
+#endif /* JERRY_GC_GENERATIONAL */
   size_t jmem_heap_allocated_size; /**< size of allocated regions */
   size_t jmem_heap_limit; /**< current limit of heap usage, that is upon being reached,
                            *   causes call of "try give memory back" callbacks */
@@ -208,6 +226,10 @@ struct jerry_context_t
   jerry_throw_cb_t vm_throw_callback_p; /**< callback for capturing throws */
 #endif /* JERRY_VM_THROW */
 
+#if JERRY_VM_INLINE_CACHE
+  uint32_t vm_inline_cache_epoch; /**< invalidation counter of the inline cache entries */
+#endif /* JERRY_VM_INLINE_CACHE */
+
 #if (JERRY_STACK_LIMIT != 0)
   uintptr_t stack_base; /**< stack base marker */
 #endif /* (JERRY_STACK_LIMIT != 0) */
@@ -240,6 +262,18 @@ struct jerry_context_t
   ecma_lcache_hash_entry_t lcache[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
 #endif /* JERRY_LCACHE */
 
+#if JERRY_VM_INLINE_CACHE
+  /** inline cache of the property access byte codes */
+  vm_inline_cache_entry_t vm_inline_cache[VM_INLINE_CACHE_SIZE];
+#endif /* JERRY_VM_INLINE_CACHE */
+
+#if JERRY_GC_GENERATIONAL
+  /** bitmap of the young objects */
+  uint8_t ecma_gc_young_bitmap[CONFIG_ECMA_GC_BITMAP_SIZE];
+  /** bitmap of the old objects which may reference young objects */
+  uint8_t ecma_gc_remembered_bitmap[CONFIG_ECMA_GC_BITMAP_SIZE];
+#endif /* JERRY_GC_GENERATIONAL */
+
   /**
    * Allowed values and it's meaning:
    * * NULL (0x0): the current "new.target" is undefined, that is the execution is inside a normal method.
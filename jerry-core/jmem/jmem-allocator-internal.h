@@ -52,6 +52,7 @@ void jmem_heap_finalize (void);
 bool jmem_is_heap_pointer (const void *pointer);
 void *jmem_heap_alloc_block_internal (const size_t size);
 void jmem_heap_free_block_internal (void *ptr, const size_t size);
+void jmem_heap_free_pool_chunks (void);
 
 /**
  * \addtogroup poolman Memory pool manager
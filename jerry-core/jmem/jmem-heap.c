@@ -133,6 +133,31 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
 #if !JERRY_SYSTEM_ALLOCATOR
   /* Align size. */
   const size_t required_size = ((size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT) * JMEM_ALIGNMENT;
+
+  /* Fastest path for small blocks, reuse a chunk of the same size class. */
+  if (required_size <= JERRY_MEM_POOL_MAX_CHUNK_SIZE)
+  {
+    jmem_pools_chunk_t **free_list_p = JERRY_CONTEXT (jmem_free_chunk_p) + JMEM_POOLS_GET_SIZE_CLASS (required_size);
+    jmem_pools_chunk_t *const chunk_p = *free_list_p;
+
+    if (chunk_p != NULL)
+    {
+      JMEM_VALGRIND_DEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+      *free_list_p = chunk_p->next_p;
+      JMEM_VALGRIND_NOACCESS_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+
+      JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
+
+      if (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+      {
+        JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+      }
+
+      JMEM_VALGRIND_MALLOCLIKE_SPACE (chunk_p, size);
+      return (void *) chunk_p;
+    }
+  }
+
   jmem_heap_free_t *data_space_p = NULL;
 
   JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
@@ -475,13 +500,28 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
 
   const size_t aligned_size = (size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
 
-  jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
-  jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
-  jmem_heap_insert_block (block_p, prev_p, aligned_size);
+  if (aligned_size <= JERRY_MEM_POOL_MAX_CHUNK_SIZE)
+  {
+    /* Small blocks are kept on the free list of their size class. */
+    jmem_pools_chunk_t **free_list_p = JERRY_CONTEXT (jmem_free_chunk_p) + JMEM_POOLS_GET_SIZE_CLASS (aligned_size);
+    jmem_pools_chunk_t *const chunk_p = (jmem_pools_chunk_t *) ptr;
+
+    JMEM_VALGRIND_FREELIKE_SPACE (ptr);
+    JMEM_VALGRIND_DEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+    chunk_p->next_p = *free_list_p;
+    JMEM_VALGRIND_NOACCESS_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+    *free_list_p = chunk_p;
+  }
+  else
+  {
+    jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
+    jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
+    jmem_heap_insert_block (block_p, prev_p, aligned_size);
 
-  JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
+    JMEM_VALGRIND_FREELIKE_SPACE (ptr);
+  }
 
-  JMEM_VALGRIND_FREELIKE_SPACE (ptr);
+  JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
 #else /* JERRY_SYSTEM_ALLOCATOR */
   JERRY_CONTEXT (jmem_heap_allocated_size) -= size;
   free (ptr);
@@ -494,6 +534,34 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
   JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_limit) >= JERRY_CONTEXT (jmem_heap_allocated_size));
 } /* jmem_heap_free_block_internal */
 
+/**
+ * Return the chunks of the size class free lists to the free region list of the heap,
+ * so they can be merged with their neighbours and used for allocating larger blocks.
+ */
+void
+jmem_heap_free_pool_chunks (void)
+{
+#if !JERRY_SYSTEM_ALLOCATOR
+  for (uint32_t i = 0; i < JMEM_POOLS_SIZE_CLASS_COUNT; i++)
+  {
+    jmem_pools_chunk_t *chunk_p = JERRY_CONTEXT (jmem_free_chunk_p)[i];
+    JERRY_CONTEXT (jmem_free_chunk_p)[i] = NULL;
+
+    while (chunk_p != NULL)
+    {
+      JMEM_VALGRIND_DEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+      jmem_pools_chunk_t *const next_p = chunk_p->next_p;
+      JMEM_VALGRIND_NOACCESS_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+
+      /* The chunks are not part of the allocated size, only their place is changed. */
+      jmem_heap_free_t *const block_p = (jmem_heap_free_t *) chunk_p;
+      jmem_heap_insert_block (block_p, jmem_heap_find_prev (block_p), (i + 1) * JMEM_ALIGNMENT);
+      chunk_p = next_p;
+    }
+  }
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
+} /* jmem_heap_free_pool_chunks */
+
 /**
  * Reallocates the memory region pointed to by 'ptr', changing the size of the allocated region.
  *
@@ -122,6 +122,16 @@ typedef enum
   JMEM_PRESSURE_FULL, /**< memory full */
 } jmem_pressure_t;
 
+/**
+ * Number of pool size classes, each class covers JMEM_ALIGNMENT bytes
+ */
+#define JMEM_POOLS_SIZE_CLASS_COUNT (JERRY_MEM_POOL_MAX_CHUNK_SIZE / JMEM_ALIGNMENT)
+
+/**
+ * Get the pool size class of a chunk size
+ */
+#define JMEM_POOLS_GET_SIZE_CLASS(size) (((size) + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT - 1)
+
 /**
  * Node for free chunk list
  */
@@ -2306,7 +2306,7 @@ parser_parse_source (void *source_p, /**< source code */
 
     if (context.user_value != ECMA_VALUE_EMPTY)
     {
-      CBC_SCRIPT_GET_USER_VALUE (context.script_p) = ecma_copy_value_if_not_object (context.user_value);
+      CBC_SCRIPT_GET_USER_VALUE (context.script_p) = ecma_copy_value_if_not_object (NULL, context.user_value);
     }
 
 #if JERRY_MODULE_SYSTEM
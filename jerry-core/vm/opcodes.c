@@ -90,7 +90,7 @@ opfunc_set_data_property (ecma_object_t *object_p, /**< object */
 #endif /* JERRY_CPOINTER_32_BIT */
 
       *property_p |= ECMA_PROPERTY_FLAG_DATA | ECMA_PROPERTY_FLAG_WRITABLE;
-      prop_value_p->value = ecma_copy_value_if_not_object (value);
+      prop_value_p->value = ecma_copy_value_if_not_object (object_p, value);
       return;
     }
   }
@@ -159,6 +159,7 @@ opfunc_set_accessor (bool is_getter, /**< is getter accessor */
       ECMA_SET_POINTER (prop_value_p->getter_setter_pair.getter_cp, getter_func_p);
       ECMA_SET_POINTER (prop_value_p->getter_setter_pair.setter_cp, setter_func_p);
 #endif /* JERRY_CPOINTER_32_BIT */
+      ecma_gc_write_barrier (object_p, accessor_p);
       return;
     }
 
@@ -548,6 +549,7 @@ opfunc_append_array (ecma_value_t *stack_top_p, /**< current stack top */
 
         ecma_deref_ecma_string (index_str_p);
         prop_value_p->value = stack_top_p[i];
+        ecma_gc_write_barrier_value (array_obj_p, stack_top_p[i]);
         ecma_deref_if_object (stack_top_p[i]);
       }
     }
@@ -654,7 +656,11 @@ opfunc_create_executable_object (vm_frame_ctx_t *frame_ctx_p, /**< frame context
       ecma_deref_if_object (*new_registers_p++);
     }
 
-    vm_ref_lex_env_chain (frame_ctx_p->lex_env_p, frame_ctx_p->context_depth, new_registers_p, false);
+    vm_ref_lex_env_chain (frame_ctx_p->lex_env_p,
+                          frame_ctx_p->context_depth,
+                          new_registers_p,
+                          (ecma_object_t *) executable_object_p,
+                          false);
 
     new_registers_p += frame_ctx_p->context_depth;
 
@@ -668,7 +674,8 @@ opfunc_create_executable_object (vm_frame_ctx_t *frame_ctx_p, /**< frame context
 
   JERRY_ASSERT (*VM_GET_EXECUTABLE_ITERATOR (new_frame_ctx_p) == ECMA_VALUE_UNDEFINED);
 
-  new_frame_ctx_p->this_binding = ecma_copy_value_if_not_object (new_frame_ctx_p->this_binding);
+  new_frame_ctx_p->this_binding =
+    ecma_copy_value_if_not_object ((ecma_object_t *) executable_object_p, new_frame_ctx_p->this_binding);
 
   JERRY_CONTEXT (vm_top_context_p) = new_frame_ctx_p->prev_context_p;
 
@@ -727,6 +734,7 @@ opfunc_resume_executable_object (vm_executable_object_t *executable_object_p, /*
     vm_ref_lex_env_chain (executable_object_p->frame_ctx.lex_env_p,
                           executable_object_p->frame_ctx.context_depth,
                           register_p,
+                          NULL,
                           true);
 
     register_p += executable_object_p->frame_ctx.context_depth;
@@ -780,16 +788,23 @@ opfunc_resume_executable_object (vm_executable_object_t *executable_object_p, /*
   register_p = VM_GET_REGISTERS (&executable_object_p->frame_ctx);
   stack_top_p = executable_object_p->frame_ctx.stack_top_p;
 
+  /* The suspended frame is part of the executable object, so its values are stored into the heap. */
+  ecma_gc_write_barrier ((ecma_object_t *) executable_object_p, executable_object_p->frame_ctx.lex_env_p);
+  ecma_gc_write_barrier_value ((ecma_object_t *) executable_object_p, executable_object_p->frame_ctx.this_binding);
+  ecma_gc_write_barrier_value ((ecma_object_t *) executable_object_p, executable_object_p->iterator);
+
   if (executable_object_p->frame_ctx.context_depth > 0)
   {
     while (register_p < register_end_p)
     {
+      ecma_gc_write_barrier_value ((ecma_object_t *) executable_object_p, *register_p);
       ecma_deref_if_object (*register_p++);
     }
 
     vm_ref_lex_env_chain (executable_object_p->frame_ctx.lex_env_p,
                           executable_object_p->frame_ctx.context_depth,
                           register_p,
+                          (ecma_object_t *) executable_object_p,
                           false);
 
     register_p += executable_object_p->frame_ctx.context_depth;
@@ -797,6 +812,7 @@ opfunc_resume_executable_object (vm_executable_object_t *executable_object_p, /*
 
   while (register_p < stack_top_p)
   {
+    ecma_gc_write_barrier_value ((ecma_object_t *) executable_object_p, *register_p);
     ecma_deref_if_object (*register_p++);
   }
 
@@ -874,6 +890,7 @@ opfunc_async_create_and_await (vm_frame_ctx_t *frame_ctx_p, /**< frame context *
 
   JERRY_ASSERT (ecma_is_value_object (result));
   executable_object_p->iterator = result;
+  ecma_gc_write_barrier_value ((ecma_object_t *) executable_object_p, result);
 
   return result;
 } /* opfunc_async_create_and_await */
@@ -937,6 +954,7 @@ opfunc_private_method_or_accessor_add (ecma_object_t *class_object_p, /**< the f
       ecma_property_value_t *prop_value_p =
         ecma_create_named_data_property (this_obj_p, prop_name_p, ECMA_PROPERTY_FIXED, NULL);
       prop_value_p->value = method;
+      ecma_gc_write_barrier_value (this_obj_p, method);
       continue;
     }
 
@@ -1202,6 +1220,7 @@ opfunc_set_home_object (ecma_object_t *func_p, /**< function object */
     ECMA_SET_NON_NULL_POINTER_TAG (ext_func_p->u.function.scope_cp,
                                    parent_env_p,
                                    JMEM_CP_GET_POINTER_TAG_BITS (ext_func_p->u.function.scope_cp));
+    ecma_gc_write_barrier (func_p, parent_env_p);
   }
 } /* opfunc_set_home_object */
 
@@ -1387,7 +1406,7 @@ opfunc_private_field_add (ecma_value_t base, /**< base object */
   ecma_property_value_t *value_p =
     ecma_create_named_data_property (obj_p, private_key_p, ECMA_PROPERTY_FLAG_WRITABLE, NULL);
 
-  value_p->value = ecma_copy_value_if_not_object (value);
+  value_p->value = ecma_copy_value_if_not_object (obj_p, value);
 
   return ECMA_VALUE_EMPTY;
 } /* opfunc_private_field_add */
@@ -1434,7 +1453,7 @@ opfunc_private_set (ecma_value_t base, /**< this object */
     }
     else
     {
-      ecma_value_assign_value (&ECMA_PROPERTY_VALUE_PTR (prop_p)->value, value);
+      ecma_value_assign_value (obj_p, &ECMA_PROPERTY_VALUE_PTR (prop_p)->value, value);
       result = ecma_copy_value (value);
     }
   }
@@ -1746,6 +1765,7 @@ opfunc_init_class (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
                                                       ECMA_PROPERTY_FIXED,
                                                       NULL);
   property_value_p->value = proto;
+  ecma_gc_write_barrier_value (ctor_p, proto);
 
   /* 18. */
   property_value_p = ecma_create_named_data_property (proto_p,
@@ -1753,6 +1773,7 @@ opfunc_init_class (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
                                                       ECMA_PROPERTY_CONFIGURABLE_WRITABLE,
                                                       NULL);
   property_value_p->value = ecma_make_object_value (ctor_p);
+  ecma_gc_write_barrier (proto_p, ctor_p);
 
   if (ecma_get_object_type (ctor_p) == ECMA_OBJECT_TYPE_FUNCTION)
   {
@@ -1792,6 +1813,7 @@ opfunc_bind_class_environment (ecma_object_t *lex_env_p, /**< lexical environmen
   {
     JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION);
     ECMA_SET_NON_NULL_POINTER_TAG (((ecma_extended_object_t *) func_obj_p)->u.function.scope_cp, proto_env_p, 0);
+    ecma_gc_write_barrier (func_obj_p, proto_env_p);
     ecma_deref_object (proto_env_p);
     return NULL;
   }
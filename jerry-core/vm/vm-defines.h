@@ -161,6 +161,53 @@ struct jerry_frame_internal_t
   ecma_value_t this_binding; /**< this binding passed to the function */
 };
 
+#if JERRY_VM_INLINE_CACHE
+
+/**
+ * Number of entries in the inline cache (must be a power of 2)
+ */
+#define VM_INLINE_CACHE_SIZE 256
+
+/**
+ * Get the inline cache entry assigned to a property access byte code
+ *
+ * Note:
+ *   property access byte codes are at least two bytes long, so
+ *   consecutive byte codes are assigned to different entries
+ */
+#define VM_INLINE_CACHE_GET_ENTRY(byte_code_p) \
+  (JERRY_CONTEXT (vm_inline_cache) + ((((uintptr_t) (byte_code_p)) >> 1) & (VM_INLINE_CACHE_SIZE - 1)))
+
+/**
+ * Maximum index of the property pair whose position is stored by the inline cache
+ */
+#define VM_INLINE_CACHE_MAX_PAIR_INDEX 7
+
+/**
+ * Pair index of inline cache entries whose property is too far from the start of the property list
+ */
+#define VM_INLINE_CACHE_NO_PAIR_INDEX UINT8_MAX
+
+/**
+ * Entry of the inline cache
+ *
+ * Note:
+ *   the property_pair_cp member is valid only while the epoch matches the vm_inline_cache_epoch
+ *   of the context, which is increased whenever a property is freed
+ */
+typedef struct
+{
+  ecma_value_t name; /**< property name value used by the byte code */
+  uint32_t epoch; /**< value of vm_inline_cache_epoch when the entry was filled */
+  jmem_cpointer_t object_cp; /**< compressed pointer to the object */
+  jmem_cpointer_t property_pair_cp; /**< compressed pointer to the property pair of the property */
+  uint8_t property_index; /**< index of the property in its property pair */
+  uint8_t pair_index; /**< index of the property pair counted from the start of the
+                       *   property list, or VM_INLINE_CACHE_NO_PAIR_INDEX */
+} vm_inline_cache_entry_t;
+
+#endif /* JERRY_VM_INLINE_CACHE */
+
 /**
  * @}
  * @}
@@ -472,6 +472,8 @@ void
 vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment */
                       uint16_t context_depth, /**< depth of function context */
                       ecma_value_t *context_end_p, /**< end of function context */
+                      ecma_object_t *holder_p, /**< executable object which holds the context,
+                                                *   when the lexical environments are dereferenced */
                       bool do_ref) /**< ref or deref lexical environments */
 {
   ecma_value_t *context_top_p = context_end_p + context_depth;
@@ -490,6 +492,7 @@ vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment
       }
       else
       {
+        ecma_gc_write_barrier (holder_p, lex_env_p);
         ecma_deref_object (lex_env_p);
       }
 
@@ -510,7 +513,8 @@ vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment
         }
         else
         {
-          ecma_deref_if_object (*(--context_top_p));
+          ecma_gc_write_barrier_value (holder_p, *(--context_top_p));
+          ecma_deref_if_object (*context_top_p);
         }
       } while (context_top_p > last_item_p);
 
@@ -529,6 +533,7 @@ vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment
       }
       else
       {
+        ecma_gc_write_barrier_value (holder_p, context_top_p[offset]);
         ecma_deref_if_object (context_top_p[offset]);
       }
 
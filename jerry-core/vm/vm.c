@@ -51,6 +51,248 @@
 JERRY_STATIC_ASSERT ((sizeof (vm_frame_ctx_t) % sizeof (ecma_value_t)) == 0,
                      sizeof_vm_frame_ctx_must_be_sizeof_ecma_value_t_aligned);
 
+#if JERRY_VM_INLINE_CACHE
+
+/**
+ * Invalidate all entries of the inline cache.
+ *
+ * Note:
+ *   must be called before a property is freed, since
+ *   the entries hold direct pointers to properties
+ */
+void
+vm_inline_cache_invalidate (void)
+{
+  if (JERRY_UNLIKELY (++JERRY_CONTEXT (vm_inline_cache_epoch) == 0))
+  {
+    /* Old entries could become valid again after the counter overflows. */
+    memset (JERRY_CONTEXT (vm_inline_cache), 0, sizeof (JERRY_CONTEXT (vm_inline_cache)));
+  }
+} /* vm_inline_cache_invalidate */
+
+/**
+ * Checks whether the own data properties of an object can be accessed through the inline cache.
+ *
+ * @return true - if getting or setting an own data property of the object has no side effects
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_inline_cache_is_cacheable (ecma_object_t *object_p) /**< object */
+{
+  return ecma_get_object_type (object_p) <= ECMA_OBJECT_TYPE_BUILT_IN_GENERAL;
+} /* vm_inline_cache_is_cacheable */
+
+/**
+ * Get the first property pair of an object, skipping the property hashmap.
+ *
+ * @return pointer to the property pair - if the object has properties
+ *         NULL - otherwise
+ */
+static inline ecma_property_header_t *JERRY_ATTR_ALWAYS_INLINE
+vm_inline_cache_first_pair (ecma_object_t *object_p) /**< object */
+{
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  if (prop_iter_cp == JMEM_CP_NULL)
+  {
+    return NULL;
+  }
+
+  ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+#if JERRY_PROPERTY_HASHMAP
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_cp = prop_iter_p->next_property_cp;
+
+    if (prop_iter_cp == JMEM_CP_NULL)
+    {
+      return NULL;
+    }
+
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+  }
+#endif /* JERRY_PROPERTY_HASHMAP */
+
+  return prop_iter_p;
+} /* vm_inline_cache_first_pair */
+
+/**
+ * Find the own property of an object through an inline cache entry.
+ *
+ * The entry matches either the same object (while no property has been freed since
+ * the entry was filled), or any other object whose property list has the same
+ * layout up to the cached position, e.g. objects created by the same constructor.
+ * In both cases the name of the cached property slot must be the requested name.
+ *
+ * @return pointer to the property - if the lookup is successful
+ *         NULL - otherwise
+ */
+static inline ecma_property_t *JERRY_ATTR_ALWAYS_INLINE
+vm_inline_cache_lookup (vm_inline_cache_entry_t *cache_entry_p, /**< cache entry */
+                        ecma_object_t *object_p, /**< object */
+                        ecma_value_t name) /**< property name */
+{
+  if (cache_entry_p->name != name)
+  {
+    return NULL;
+  }
+
+  uint32_t index = cache_entry_p->property_index;
+  ecma_property_header_t *prop_iter_p;
+  jmem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  if (cache_entry_p->object_cp == object_cp && cache_entry_p->epoch == JERRY_CONTEXT (vm_inline_cache_epoch))
+  {
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, cache_entry_p->property_pair_cp);
+  }
+  else
+  {
+    uint32_t pair_index = cache_entry_p->pair_index;
+
+    if (pair_index == VM_INLINE_CACHE_NO_PAIR_INDEX)
+    {
+      return NULL;
+    }
+
+    prop_iter_p = vm_inline_cache_first_pair (object_p);
+
+    if (prop_iter_p == NULL)
+    {
+      return NULL;
+    }
+
+    while (pair_index > 0)
+    {
+      if (prop_iter_p->next_property_cp == JMEM_CP_NULL)
+      {
+        return NULL;
+      }
+
+      prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+      pair_index--;
+    }
+  }
+
+  /* The cached name value alone is not enough: the string it referred to might have
+   * been freed since the entry was filled, and another string can reuse its address. */
+  ecma_string_t *name_p = ecma_get_string_from_value (name);
+  ecma_property_t name_type = ECMA_DIRECT_STRING_PTR;
+  jmem_cpointer_t name_cp;
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (name_cp, name_p);
+  }
+
+  ecma_property_t *property_p = prop_iter_p->types + index;
+
+  if (((ecma_property_pair_t *) prop_iter_p)->names_cp[index] != name_cp || !ECMA_PROPERTY_IS_RAW (*property_p)
+      || ECMA_PROPERTY_GET_NAME_TYPE (*property_p) != name_type)
+  {
+    return NULL;
+  }
+
+  return property_p;
+} /* vm_inline_cache_lookup */
+
+/**
+ * Fill an inline cache entry.
+ */
+static void
+vm_inline_cache_insert (vm_inline_cache_entry_t *cache_entry_p, /**< cache entry */
+                        ecma_object_t *object_p, /**< object */
+                        ecma_value_t name, /**< property name */
+                        ecma_property_t *property_p) /**< own data property of the object */
+{
+  JERRY_ASSERT (ECMA_PROPERTY_IS_RAW (*property_p) && !ECMA_PROPERTY_IS_INTERNAL (*property_p));
+
+  /* Property pairs are aligned to JMEM_ALIGNMENT, and both property types are in the first JMEM_ALIGNMENT bytes. */
+  ecma_property_header_t *property_pair_p =
+    (ecma_property_header_t *) (((uintptr_t) property_p) & ~((uintptr_t) JMEM_ALIGNMENT - 1));
+
+  JERRY_ASSERT (property_p == property_pair_p->types + 0 || property_p == property_pair_p->types + 1);
+
+  ecma_property_header_t *prop_iter_p = vm_inline_cache_first_pair (object_p);
+  uint32_t pair_index = 0;
+
+  while (prop_iter_p != property_pair_p)
+  {
+    JERRY_ASSERT (prop_iter_p != NULL && ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    if (pair_index == VM_INLINE_CACHE_MAX_PAIR_INDEX || prop_iter_p->next_property_cp == JMEM_CP_NULL)
+    {
+      pair_index = VM_INLINE_CACHE_NO_PAIR_INDEX;
+      break;
+    }
+
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+    pair_index++;
+  }
+
+  cache_entry_p->name = name;
+  cache_entry_p->epoch = JERRY_CONTEXT (vm_inline_cache_epoch);
+  ECMA_SET_NON_NULL_POINTER (cache_entry_p->object_cp, object_p);
+  ECMA_SET_NON_NULL_POINTER (cache_entry_p->property_pair_cp, property_pair_p);
+  cache_entry_p->property_index = (uint8_t) (property_p - property_pair_p->types);
+  cache_entry_p->pair_index = (uint8_t) pair_index;
+} /* vm_inline_cache_insert */
+
+/**
+ * Get the value of a string named property of an object which can be accessed through the inline cache.
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+vm_inline_cache_get_value (vm_inline_cache_entry_t *cache_entry_p, /**< cache entry */
+                           ecma_object_t *object_p, /**< object */
+                           ecma_value_t name) /**< property name */
+{
+  JERRY_ASSERT (vm_inline_cache_is_cacheable (object_p) && ecma_is_value_string (name));
+
+  ecma_property_t *property_p = vm_inline_cache_lookup (cache_entry_p, object_p, name);
+
+  if (property_p != NULL && (*property_p & ECMA_PROPERTY_FLAG_DATA))
+  {
+    return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+  }
+
+  ecma_string_t *name_p = ecma_get_string_from_value (name);
+  property_p = ecma_find_named_property (object_p, name_p);
+
+  if (property_p != NULL)
+  {
+    if (*property_p & ECMA_PROPERTY_FLAG_DATA)
+    {
+      vm_inline_cache_insert (cache_entry_p, object_p, name, property_p);
+      return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+    }
+  }
+  else if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    /* Ordinary objects have no lazy instantiated properties, so the own property lookup can be skipped. */
+    jmem_cpointer_t proto_cp = ecma_op_ordinary_object_get_prototype_of (object_p);
+
+    if (proto_cp == JMEM_CP_NULL)
+    {
+      return ECMA_VALUE_UNDEFINED;
+    }
+
+    ecma_object_t *proto_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, proto_cp);
+    return ecma_op_object_get_with_receiver (proto_p, name_p, ecma_make_object_value (object_p));
+  }
+
+  return ecma_op_object_get (object_p, name_p);
+} /* vm_inline_cache_get_value */
+
+#endif /* JERRY_VM_INLINE_CACHE */
+
 /**
  * Get the value of object[property].
  *
@@ -58,8 +300,13 @@ JERRY_STATIC_ASSERT ((sizeof (vm_frame_ctx_t) % sizeof (ecma_value_t)) == 0,
  */
 static ecma_value_t
 vm_op_get_value (ecma_value_t object, /**< base object */
-                 ecma_value_t property) /**< property name */
+                 ecma_value_t property, /**< property name */
+                 const uint8_t *byte_code_p) /**< start of the current byte code */
 {
+#if !JERRY_VM_INLINE_CACHE
+  JERRY_UNUSED (byte_code_p);
+#endif /* !JERRY_VM_INLINE_CACHE */
+
   if (ecma_is_value_object (object))
   {
     ecma_object_t *object_p = ecma_get_object_from_value (object);
@@ -102,6 +349,13 @@ vm_op_get_value (ecma_value_t object, /**< base object */
 
     if (property_name_p != NULL)
     {
+#if JERRY_VM_INLINE_CACHE
+      if (ecma_is_value_string (property) && vm_inline_cache_is_cacheable (object_p))
+      {
+        return vm_inline_cache_get_value (VM_INLINE_CACHE_GET_ENTRY (byte_code_p), object_p, property);
+      }
+#endif /* JERRY_VM_INLINE_CACHE */
+
 #if JERRY_LCACHE
       ecma_property_t *property_p = ecma_lcache_lookup (object_p, property_name_p);
 
@@ -154,8 +408,13 @@ static ecma_value_t
 vm_op_set_value (ecma_value_t base, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
-                 bool is_strict) /**< strict mode */
+                 bool is_strict, /**< strict mode */
+                 const uint8_t *byte_code_p) /**< start of the current byte code */
 {
+#if !JERRY_VM_INLINE_CACHE
+  JERRY_UNUSED (byte_code_p);
+#endif /* !JERRY_VM_INLINE_CACHE */
+
   ecma_value_t result = ECMA_VALUE_EMPTY;
   ecma_object_t *object_p;
   ecma_string_t *property_p;
@@ -221,7 +480,41 @@ vm_op_set_value (ecma_value_t base, /**< base object */
 
     if (!ecma_is_lexical_environment (object_p))
     {
+#if JERRY_VM_INLINE_CACHE
+      if (ecma_is_value_string (property) && vm_inline_cache_is_cacheable (object_p))
+      {
+        vm_inline_cache_entry_t *cache_entry_p = VM_INLINE_CACHE_GET_ENTRY (byte_code_p);
+        ecma_property_t *own_property_p = vm_inline_cache_lookup (cache_entry_p, object_p, property);
+
+        if (own_property_p != NULL && (*own_property_p & ECMA_PROPERTY_FLAG_DATA)
+            && ecma_is_property_writable (*own_property_p))
+        {
+          ecma_named_data_property_assign_value (object_p, ECMA_PROPERTY_VALUE_PTR (own_property_p), value);
+          result = ECMA_VALUE_TRUE;
+        }
+        else
+        {
+          result = ecma_op_object_put_with_receiver (object_p, property_p, value, base, is_strict);
+
+          if (result == ECMA_VALUE_TRUE)
+          {
+            own_property_p = ecma_find_named_property (object_p, property_p);
+
+            if (own_property_p != NULL && (*own_property_p & ECMA_PROPERTY_FLAG_DATA)
+                && ecma_is_property_writable (*own_property_p))
+            {
+              vm_inline_cache_insert (cache_entry_p, object_p, property, own_property_p);
+            }
+          }
+        }
+      }
+      else
+      {
+        result = ecma_op_object_put_with_receiver (object_p, property_p, value, base, is_strict);
+      }
+#else /* !JERRY_VM_INLINE_CACHE */
       result = ecma_op_object_put_with_receiver (object_p, property_p, value, base, is_strict);
+#endif /* JERRY_VM_INLINE_CACHE */
     }
     else
     {
@@ -900,9 +1193,9 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       }                                                                                           \
       else                                                                                        \
       {                                                                                           \
-        ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);      \
+        ecma_string_t *read_name_p = ecma_get_string_from_value (literal_start_p[literal_index]);         \
                                                                                                   \
-        result = ecma_op_resolve_reference_value (frame_ctx_p->lex_env_p, name_p);                \
+        result = ecma_op_resolve_reference_value (frame_ctx_p->lex_env_p, read_name_p);                   \
                                                                                                   \
         if (ECMA_IS_VALUE_ERROR (result))                                                         \
         {                                                                                         \
@@ -960,6 +1253,197 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
  */
 #define VM_LAST_CONTEXT_END() (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth)
 
+/**
+ * Call the vm execution stop callback when its counter reaches zero.
+ */
+#if JERRY_VM_HALT
+#define VM_CHECK_EXEC_STOP()                                                                    \
+  do                                                                                            \
+  {                                                                                             \
+    if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL && --JERRY_CONTEXT (vm_exec_stop_counter) == 0) \
+    {                                                                                           \
+      result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));           \
+                                                                                                \
+      if (ecma_is_value_undefined (result))                                                     \
+      {                                                                                         \
+        JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);          \
+      }                                                                                         \
+      else                                                                                      \
+      {                                                                                         \
+        JERRY_CONTEXT (vm_exec_stop_counter) = 1;                                               \
+                                                                                                \
+        if (ecma_is_value_exception (result))                                                   \
+        {                                                                                       \
+          ecma_throw_exception (result);                                                        \
+        }                                                                                       \
+        else                                                                                    \
+        {                                                                                       \
+          jcontext_raise_exception (result);                                                    \
+        }                                                                                       \
+                                                                                                \
+        JERRY_ASSERT (jcontext_has_pending_exception ());                                       \
+        jcontext_set_abort_flag (true);                                                         \
+        result = ECMA_VALUE_ERROR;                                                              \
+        goto error;                                                                             \
+      }                                                                                         \
+    }                                                                                           \
+  } while (0)
+#else /* !JERRY_VM_HALT */
+#define VM_CHECK_EXEC_STOP()
+#endif /* JERRY_VM_HALT */
+
+/**
+ * Decode the input arguments of an instruction.
+ *
+ * @param opcode_data_value decoded opcode data
+ * @param opcode_value opcode (or extended opcode) of the instruction
+ */
+#define VM_DECODE_OPERANDS(opcode_data_value, opcode_value)                         \
+  do                                                                                \
+  {                                                                                 \
+    left_value = ECMA_VALUE_UNDEFINED;                                              \
+    right_value = ECMA_VALUE_UNDEFINED;                                             \
+                                                                                    \
+    if (VM_OC_GET_ARGS_INDEX (opcode_data_value) >= VM_OC_GET_LITERAL)              \
+    {                                                                               \
+      uint16_t first_literal_index;                                                   \
+      READ_LITERAL_INDEX (first_literal_index);                                       \
+      READ_LITERAL (first_literal_index, left_value);                                 \
+                                                                                    \
+      if (VM_OC_GET_ARGS_INDEX (opcode_data_value) == VM_OC_GET_LITERAL_LITERAL)    \
+      {                                                                             \
+        uint16_t second_literal_index;                                              \
+        READ_LITERAL_INDEX (second_literal_index);                                  \
+        READ_LITERAL (second_literal_index, right_value);                           \
+      }                                                                             \
+      else if (VM_OC_GET_ARGS_INDEX (opcode_data_value) == VM_OC_GET_STACK_LITERAL) \
+      {                                                                             \
+        JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end); \
+        right_value = left_value;                                                   \
+        left_value = *(--stack_top_p);                                              \
+      }                                                                             \
+      else if (VM_OC_GET_ARGS_INDEX (opcode_data_value) == VM_OC_GET_THIS_LITERAL)  \
+      {                                                                             \
+        right_value = left_value;                                                   \
+        left_value = ecma_copy_value (frame_ctx_p->this_binding);                   \
+      }                                                                             \
+    }                                                                               \
+    else if (VM_OC_GET_ARGS_INDEX (opcode_data_value) >= VM_OC_GET_STACK)           \
+    {                                                                               \
+      JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);   \
+      left_value = *(--stack_top_p);                                                \
+                                                                                    \
+      if (VM_OC_GET_ARGS_INDEX (opcode_data_value) == VM_OC_GET_STACK_STACK)        \
+      {                                                                             \
+        JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end); \
+        right_value = left_value;                                                   \
+        left_value = *(--stack_top_p);                                              \
+      }                                                                             \
+    }                                                                               \
+    else if (VM_OC_GET_ARGS_INDEX (opcode_data_value) == VM_OC_GET_BRANCH)          \
+    {                                                                               \
+      branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode_value);               \
+      JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);        \
+                                                                                    \
+      branch_offset = *(byte_code_p++);                                             \
+                                                                                    \
+      if (JERRY_UNLIKELY (branch_offset_length != 1))                               \
+      {                                                                             \
+        branch_offset <<= 8;                                                        \
+        branch_offset |= *(byte_code_p++);                                          \
+                                                                                    \
+        if (JERRY_UNLIKELY (branch_offset_length == 3))                             \
+        {                                                                           \
+          branch_offset <<= 8;                                                      \
+          branch_offset |= *(byte_code_p++);                                        \
+        }                                                                           \
+      }                                                                             \
+                                                                                    \
+      if ((opcode_data_value) & VM_OC_BACKWARD_BRANCH)                              \
+      {                                                                             \
+        VM_CHECK_EXEC_STOP ();                                                      \
+        branch_offset = -branch_offset;                                             \
+      }                                                                             \
+    }                                                                               \
+  } while (0)
+
+/**
+ * Fetch the next instruction and decode its input arguments.
+ */
+#define VM_DECODE_INSTRUCTION()                            \
+  do                                                       \
+  {                                                        \
+    byte_code_start_p = byte_code_p;                       \
+    opcode = *byte_code_p++;                               \
+    opcode_data = opcode;                                  \
+                                                           \
+    if (opcode == CBC_EXT_OPCODE)                          \
+    {                                                      \
+      opcode = *byte_code_p++;                             \
+      opcode_data = (uint32_t) ((CBC_END + 1) + opcode);   \
+    }                                                      \
+                                                           \
+    opcode_data = vm_decode_table[opcode_data];            \
+    VM_DECODE_OPERANDS (opcode_data, opcode);              \
+  } while (0)
+
+#if JERRY_VM_COMPUTED_GOTO
+
+/**
+ * Labels as values and computed gotos are GNU extensions, the
+ * pedantic warnings are only disabled around their uses.
+ */
+#define VM_GNU_EXTENSION_BEGIN _Pragma ("GCC diagnostic push") _Pragma ("GCC diagnostic ignored \"-Wpedantic\"")
+
+/**
+ * End of the code which uses GNU extensions.
+ */
+#define VM_GNU_EXTENSION_END _Pragma ("GCC diagnostic pop")
+
+/**
+ * Case label of the opcode group handlers, which is also
+ * the target of the direct threaded dispatch.
+ */
+#define VM_CASE(group) \
+  case group:          \
+  vm_label_##group
+
+/**
+ * Jump to the handler of the decoded instruction.
+ */
+#define VM_GOTO_HANDLER()                                                          \
+  do                                                                               \
+  {                                                                                \
+    JERRY_ASSERT (vm_group_labels[VM_OC_GROUP_GET_INDEX (opcode_data)] != NULL);   \
+    VM_GNU_EXTENSION_BEGIN goto *vm_group_labels[VM_OC_GROUP_GET_INDEX (opcode_data)]; \
+    VM_GNU_EXTENSION_END                                                           \
+  } while (0)
+
+/**
+ * End of an instruction handler: the next instruction is decoded
+ * and dispatched at the end of every handler (direct threading).
+ */
+#define VM_DISPATCH()          \
+  do                           \
+  {                            \
+    VM_DECODE_INSTRUCTION ();  \
+    VM_GOTO_HANDLER ();        \
+  } while (0)
+
+#else /* !JERRY_VM_COMPUTED_GOTO */
+
+/**
+ * Case label of the opcode group handlers.
+ */
+#define VM_CASE(group) case group
+
+/**
+ * End of an instruction handler: continue with the next instruction.
+ */
+#define VM_DISPATCH() continue
+
+#endif /* JERRY_VM_COMPUTED_GOTO */
+
 /**
  * Run generic byte code.
  *
@@ -968,6 +1452,198 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 static ecma_value_t JERRY_ATTR_NOINLINE
 vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 {
+#if JERRY_VM_COMPUTED_GOTO
+  VM_GNU_EXTENSION_BEGIN
+  static const void *const vm_group_labels[VM_OC_NONE + 1] = {
+    [VM_OC_POP] = &&vm_label_VM_OC_POP,
+    [VM_OC_POP_BLOCK] = &&vm_label_VM_OC_POP_BLOCK,
+    [VM_OC_PUSH] = &&vm_label_VM_OC_PUSH,
+    [VM_OC_PUSH_TWO] = &&vm_label_VM_OC_PUSH_TWO,
+    [VM_OC_PUSH_THREE] = &&vm_label_VM_OC_PUSH_THREE,
+    [VM_OC_PUSH_UNDEFINED] = &&vm_label_VM_OC_PUSH_UNDEFINED,
+    [VM_OC_PUSH_TRUE] = &&vm_label_VM_OC_PUSH_TRUE,
+    [VM_OC_PUSH_FALSE] = &&vm_label_VM_OC_PUSH_FALSE,
+    [VM_OC_PUSH_NULL] = &&vm_label_VM_OC_PUSH_NULL,
+    [VM_OC_PUSH_THIS] = &&vm_label_VM_OC_PUSH_THIS,
+    [VM_OC_PUSH_0] = &&vm_label_VM_OC_PUSH_0,
+    [VM_OC_PUSH_POS_BYTE] = &&vm_label_VM_OC_PUSH_POS_BYTE,
+    [VM_OC_PUSH_NEG_BYTE] = &&vm_label_VM_OC_PUSH_NEG_BYTE,
+    [VM_OC_PUSH_LIT_0] = &&vm_label_VM_OC_PUSH_LIT_0,
+    [VM_OC_PUSH_LIT_POS_BYTE] = &&vm_label_VM_OC_PUSH_LIT_POS_BYTE,
+    [VM_OC_PUSH_LIT_NEG_BYTE] = &&vm_label_VM_OC_PUSH_LIT_NEG_BYTE,
+    [VM_OC_PUSH_OBJECT] = &&vm_label_VM_OC_PUSH_OBJECT,
+    [VM_OC_PUSH_NAMED_FUNC_EXPR] = &&vm_label_VM_OC_PUSH_NAMED_FUNC_EXPR,
+    [VM_OC_CREATE_BINDING] = &&vm_label_VM_OC_CREATE_BINDING,
+    [VM_OC_VAR_EVAL] = &&vm_label_VM_OC_VAR_EVAL,
+    [VM_OC_EXT_VAR_EVAL] = &&vm_label_VM_OC_EXT_VAR_EVAL,
+    [VM_OC_CREATE_ARGUMENTS] = &&vm_label_VM_OC_CREATE_ARGUMENTS,
+#if JERRY_SNAPSHOT_EXEC
+    [VM_OC_SET_BYTECODE_PTR] = &&vm_label_VM_OC_SET_BYTECODE_PTR,
+#else /* !JERRY_SNAPSHOT_EXEC */
+    [VM_OC_SET_BYTECODE_PTR] = &&vm_label_VM_OC_NONE,
+#endif /* JERRY_SNAPSHOT_EXEC */
+    [VM_OC_INIT_ARG_OR_FUNC] = &&vm_label_VM_OC_INIT_ARG_OR_FUNC,
+    [VM_OC_CHECK_VAR] = &&vm_label_VM_OC_CHECK_VAR,
+    [VM_OC_CHECK_LET] = &&vm_label_VM_OC_CHECK_LET,
+    [VM_OC_ASSIGN_LET_CONST] = &&vm_label_VM_OC_ASSIGN_LET_CONST,
+    [VM_OC_INIT_BINDING] = &&vm_label_VM_OC_INIT_BINDING,
+    [VM_OC_THROW_CONST_ERROR] = &&vm_label_VM_OC_THROW_CONST_ERROR,
+    [VM_OC_COPY_TO_GLOBAL] = &&vm_label_VM_OC_COPY_TO_GLOBAL,
+    [VM_OC_COPY_FROM_ARG] = &&vm_label_VM_OC_COPY_FROM_ARG,
+    [VM_OC_CLONE_CONTEXT] = &&vm_label_VM_OC_CLONE_CONTEXT,
+    [VM_OC_SET__PROTO__] = &&vm_label_VM_OC_SET__PROTO__,
+    [VM_OC_CLASS_CALL_STATIC_BLOCK] = &&vm_label_VM_OC_CLASS_CALL_STATIC_BLOCK,
+    [VM_OC_PUSH_STATIC_FIELD_FUNC] = &&vm_label_VM_OC_PUSH_STATIC_FIELD_FUNC,
+    [VM_OC_ADD_COMPUTED_FIELD] = &&vm_label_VM_OC_ADD_COMPUTED_FIELD,
+    [VM_OC_COPY_DATA_PROPERTIES] = &&vm_label_VM_OC_COPY_DATA_PROPERTIES,
+    [VM_OC_SET_COMPUTED_PROPERTY] = &&vm_label_VM_OC_SET_COMPUTED_PROPERTY,
+    [VM_OC_SET_PROPERTY] = &&vm_label_VM_OC_SET_PROPERTY,
+    [VM_OC_SET_GETTER] = &&vm_label_VM_OC_SET_GETTER,
+    [VM_OC_SET_SETTER] = &&vm_label_VM_OC_SET_SETTER,
+    [VM_OC_PUSH_ARRAY] = &&vm_label_VM_OC_PUSH_ARRAY,
+    [VM_OC_LOCAL_EVAL] = &&vm_label_VM_OC_LOCAL_EVAL,
+    [VM_OC_SUPER_CALL] = &&vm_label_VM_OC_SUPER_CALL,
+    [VM_OC_PUSH_CLASS_ENVIRONMENT] = &&vm_label_VM_OC_PUSH_CLASS_ENVIRONMENT,
+    [VM_OC_PUSH_IMPLICIT_CTOR] = &&vm_label_VM_OC_PUSH_IMPLICIT_CTOR,
+    [VM_OC_DEFINE_FIELD] = &&vm_label_VM_OC_DEFINE_FIELD,
+    [VM_OC_ASSIGN_PRIVATE] = &&vm_label_VM_OC_ASSIGN_PRIVATE,
+    [VM_OC_PRIVATE_FIELD_ADD] = &&vm_label_VM_OC_PRIVATE_FIELD_ADD,
+    [VM_OC_PRIVATE_PROP_GET] = &&vm_label_VM_OC_PRIVATE_PROP_GET,
+    [VM_OC_PRIVATE_PROP_REFERENCE] = &&vm_label_VM_OC_PRIVATE_PROP_REFERENCE,
+    [VM_OC_PRIVATE_IN] = &&vm_label_VM_OC_PRIVATE_IN,
+    [VM_OC_COLLECT_PRIVATE_PROPERTY] = &&vm_label_VM_OC_COLLECT_PRIVATE_PROPERTY,
+    [VM_OC_INIT_CLASS] = &&vm_label_VM_OC_INIT_CLASS,
+    [VM_OC_FINALIZE_CLASS] = &&vm_label_VM_OC_FINALIZE_CLASS,
+    [VM_OC_SET_FIELD_INIT] = &&vm_label_VM_OC_SET_FIELD_INIT,
+    [VM_OC_RUN_FIELD_INIT] = &&vm_label_VM_OC_RUN_FIELD_INIT,
+    [VM_OC_RUN_STATIC_FIELD_INIT] = &&vm_label_VM_OC_RUN_STATIC_FIELD_INIT,
+    [VM_OC_SET_NEXT_COMPUTED_FIELD] = &&vm_label_VM_OC_SET_NEXT_COMPUTED_FIELD,
+    [VM_OC_PUSH_SUPER_CONSTRUCTOR] = &&vm_label_VM_OC_PUSH_SUPER_CONSTRUCTOR,
+    [VM_OC_RESOLVE_LEXICAL_THIS] = &&vm_label_VM_OC_RESOLVE_LEXICAL_THIS,
+    [VM_OC_OBJECT_LITERAL_HOME_ENV] = &&vm_label_VM_OC_OBJECT_LITERAL_HOME_ENV,
+    [VM_OC_SET_HOME_OBJECT] = &&vm_label_VM_OC_SET_HOME_OBJECT,
+    [VM_OC_SUPER_REFERENCE] = &&vm_label_VM_OC_SUPER_REFERENCE,
+    [VM_OC_SET_FUNCTION_NAME] = &&vm_label_VM_OC_SET_FUNCTION_NAME,
+    [VM_OC_PUSH_SPREAD_ELEMENT] = &&vm_label_VM_OC_PUSH_SPREAD_ELEMENT,
+    [VM_OC_PUSH_REST_OBJECT] = &&vm_label_VM_OC_PUSH_REST_OBJECT,
+    [VM_OC_ITERATOR_CONTEXT_CREATE] = &&vm_label_VM_OC_ITERATOR_CONTEXT_CREATE,
+    [VM_OC_ITERATOR_STEP] = &&vm_label_VM_OC_ITERATOR_STEP,
+    [VM_OC_ITERATOR_CONTEXT_END] = &&vm_label_VM_OC_ITERATOR_CONTEXT_END,
+    [VM_OC_DEFAULT_INITIALIZER] = &&vm_label_VM_OC_DEFAULT_INITIALIZER,
+    [VM_OC_REST_INITIALIZER] = &&vm_label_VM_OC_REST_INITIALIZER,
+    [VM_OC_OBJ_INIT_CONTEXT_CREATE] = &&vm_label_VM_OC_OBJ_INIT_CONTEXT_CREATE,
+    [VM_OC_OBJ_INIT_CONTEXT_END] = &&vm_label_VM_OC_OBJ_INIT_CONTEXT_END,
+    [VM_OC_OBJ_INIT_PUSH_REST] = &&vm_label_VM_OC_OBJ_INIT_PUSH_REST,
+    [VM_OC_INITIALIZER_PUSH_NAME] = &&vm_label_VM_OC_INITIALIZER_PUSH_NAME,
+    [VM_OC_INITIALIZER_PUSH_PROP] = &&vm_label_VM_OC_INITIALIZER_PUSH_PROP,
+    [VM_OC_SPREAD_ARGUMENTS] = &&vm_label_VM_OC_SPREAD_ARGUMENTS,
+    [VM_OC_CREATE_GENERATOR] = &&vm_label_VM_OC_CREATE_GENERATOR,
+    [VM_OC_YIELD] = &&vm_label_VM_OC_YIELD,
+    [VM_OC_ASYNC_YIELD] = &&vm_label_VM_OC_ASYNC_YIELD,
+    [VM_OC_ASYNC_YIELD_ITERATOR] = &&vm_label_VM_OC_ASYNC_YIELD_ITERATOR,
+    [VM_OC_AWAIT] = &&vm_label_VM_OC_AWAIT,
+    [VM_OC_GENERATOR_AWAIT] = &&vm_label_VM_OC_GENERATOR_AWAIT,
+    [VM_OC_EXT_RETURN] = &&vm_label_VM_OC_EXT_RETURN,
+    [VM_OC_ASYNC_EXIT] = &&vm_label_VM_OC_ASYNC_EXIT,
+    [VM_OC_STRING_CONCAT] = &&vm_label_VM_OC_STRING_CONCAT,
+    [VM_OC_GET_TEMPLATE_OBJECT] = &&vm_label_VM_OC_GET_TEMPLATE_OBJECT,
+    [VM_OC_PUSH_NEW_TARGET] = &&vm_label_VM_OC_PUSH_NEW_TARGET,
+    [VM_OC_REQUIRE_OBJECT_COERCIBLE] = &&vm_label_VM_OC_REQUIRE_OBJECT_COERCIBLE,
+    [VM_OC_ASSIGN_SUPER] = &&vm_label_VM_OC_ASSIGN_SUPER,
+    [VM_OC_PUSH_ELISON] = &&vm_label_VM_OC_PUSH_ELISON,
+    [VM_OC_APPEND_ARRAY] = &&vm_label_VM_OC_APPEND_ARRAY,
+    [VM_OC_IDENT_REFERENCE] = &&vm_label_VM_OC_IDENT_REFERENCE,
+    [VM_OC_PROP_GET] = &&vm_label_VM_OC_PROP_GET,
+    [VM_OC_PROP_REFERENCE] = &&vm_label_VM_OC_PROP_REFERENCE,
+    [VM_OC_PROP_PRE_INCR] = &&vm_label_VM_OC_PROP_PRE_INCR,
+    [VM_OC_PROP_PRE_DECR] = &&vm_label_VM_OC_PROP_PRE_DECR,
+    [VM_OC_PROP_POST_INCR] = &&vm_label_VM_OC_PROP_POST_INCR,
+    [VM_OC_PROP_POST_DECR] = &&vm_label_VM_OC_PROP_POST_DECR,
+    [VM_OC_PRE_INCR] = &&vm_label_VM_OC_PRE_INCR,
+    [VM_OC_PRE_DECR] = &&vm_label_VM_OC_PRE_DECR,
+    [VM_OC_POST_INCR] = &&vm_label_VM_OC_POST_INCR,
+    [VM_OC_POST_DECR] = &&vm_label_VM_OC_POST_DECR,
+    [VM_OC_ASSIGN] = &&vm_label_VM_OC_ASSIGN,
+    [VM_OC_MOV_IDENT] = &&vm_label_VM_OC_MOV_IDENT,
+    [VM_OC_ASSIGN_PROP] = &&vm_label_VM_OC_ASSIGN_PROP,
+    [VM_OC_ASSIGN_PROP_THIS] = &&vm_label_VM_OC_ASSIGN_PROP_THIS,
+    [VM_OC_RETURN_FUNCTION_END] = &&vm_label_VM_OC_RETURN_FUNCTION_END,
+    [VM_OC_RETURN] = &&vm_label_VM_OC_RETURN,
+    [VM_OC_THROW] = &&vm_label_VM_OC_THROW,
+    [VM_OC_THROW_REFERENCE_ERROR] = &&vm_label_VM_OC_THROW_REFERENCE_ERROR,
+    [VM_OC_EVAL] = &&vm_label_VM_OC_EVAL,
+    [VM_OC_CALL] = &&vm_label_VM_OC_CALL,
+    [VM_OC_NEW] = &&vm_label_VM_OC_NEW,
+    [VM_OC_ERROR] = &&vm_label_VM_OC_ERROR,
+    [VM_OC_RESOLVE_BASE_FOR_CALL] = &&vm_label_VM_OC_RESOLVE_BASE_FOR_CALL,
+    [VM_OC_PROP_DELETE] = &&vm_label_VM_OC_PROP_DELETE,
+    [VM_OC_DELETE] = &&vm_label_VM_OC_DELETE,
+    [VM_OC_JUMP] = &&vm_label_VM_OC_JUMP,
+    [VM_OC_BRANCH_IF_STRICT_EQUAL] = &&vm_label_VM_OC_BRANCH_IF_STRICT_EQUAL,
+    [VM_OC_BRANCH_IF_TRUE] = &&vm_label_VM_OC_BRANCH_IF_TRUE,
+    [VM_OC_BRANCH_IF_FALSE] = &&vm_label_VM_OC_BRANCH_IF_FALSE,
+    [VM_OC_BRANCH_IF_LOGICAL_TRUE] = &&vm_label_VM_OC_BRANCH_IF_LOGICAL_TRUE,
+    [VM_OC_BRANCH_IF_LOGICAL_FALSE] = &&vm_label_VM_OC_BRANCH_IF_LOGICAL_FALSE,
+    [VM_OC_BRANCH_OPTIONAL_CHAIN] = &&vm_label_VM_OC_BRANCH_OPTIONAL_CHAIN,
+    [VM_OC_POP_REFERENCE] = &&vm_label_VM_OC_POP_REFERENCE,
+    [VM_OC_BRANCH_IF_NULLISH] = &&vm_label_VM_OC_BRANCH_IF_NULLISH,
+    [VM_OC_PLUS] = &&vm_label_VM_OC_PLUS,
+    [VM_OC_MINUS] = &&vm_label_VM_OC_MINUS,
+    [VM_OC_NOT] = &&vm_label_VM_OC_NOT,
+    [VM_OC_BIT_NOT] = &&vm_label_VM_OC_BIT_NOT,
+    [VM_OC_VOID] = &&vm_label_VM_OC_VOID,
+    [VM_OC_TYPEOF_IDENT] = &&vm_label_VM_OC_TYPEOF_IDENT,
+    [VM_OC_TYPEOF] = &&vm_label_VM_OC_TYPEOF,
+    [VM_OC_ADD] = &&vm_label_VM_OC_ADD,
+    [VM_OC_SUB] = &&vm_label_VM_OC_SUB,
+    [VM_OC_MUL] = &&vm_label_VM_OC_MUL,
+    [VM_OC_DIV] = &&vm_label_VM_OC_DIV,
+    [VM_OC_MOD] = &&vm_label_VM_OC_MOD,
+    [VM_OC_EXP] = &&vm_label_VM_OC_EXP,
+    [VM_OC_EQUAL] = &&vm_label_VM_OC_EQUAL,
+    [VM_OC_NOT_EQUAL] = &&vm_label_VM_OC_NOT_EQUAL,
+    [VM_OC_STRICT_EQUAL] = &&vm_label_VM_OC_STRICT_EQUAL,
+    [VM_OC_STRICT_NOT_EQUAL] = &&vm_label_VM_OC_STRICT_NOT_EQUAL,
+    [VM_OC_BIT_OR] = &&vm_label_VM_OC_BIT_OR,
+    [VM_OC_BIT_XOR] = &&vm_label_VM_OC_BIT_XOR,
+    [VM_OC_BIT_AND] = &&vm_label_VM_OC_BIT_AND,
+    [VM_OC_LEFT_SHIFT] = &&vm_label_VM_OC_LEFT_SHIFT,
+    [VM_OC_RIGHT_SHIFT] = &&vm_label_VM_OC_RIGHT_SHIFT,
+    [VM_OC_UNS_RIGHT_SHIFT] = &&vm_label_VM_OC_UNS_RIGHT_SHIFT,
+    [VM_OC_LESS] = &&vm_label_VM_OC_LESS,
+    [VM_OC_GREATER] = &&vm_label_VM_OC_GREATER,
+    [VM_OC_LESS_EQUAL] = &&vm_label_VM_OC_LESS_EQUAL,
+    [VM_OC_GREATER_EQUAL] = &&vm_label_VM_OC_GREATER_EQUAL,
+    [VM_OC_IN] = &&vm_label_VM_OC_IN,
+    [VM_OC_INSTANCEOF] = &&vm_label_VM_OC_INSTANCEOF,
+    [VM_OC_BLOCK_CREATE_CONTEXT] = &&vm_label_VM_OC_BLOCK_CREATE_CONTEXT,
+    [VM_OC_WITH] = &&vm_label_VM_OC_WITH,
+    [VM_OC_FOR_IN_INIT] = &&vm_label_VM_OC_FOR_IN_INIT,
+    [VM_OC_FOR_IN_GET_NEXT] = &&vm_label_VM_OC_FOR_IN_GET_NEXT,
+    [VM_OC_FOR_IN_HAS_NEXT] = &&vm_label_VM_OC_FOR_IN_HAS_NEXT,
+    [VM_OC_FOR_OF_INIT] = &&vm_label_VM_OC_FOR_OF_INIT,
+    [VM_OC_FOR_OF_GET_NEXT] = &&vm_label_VM_OC_FOR_OF_GET_NEXT,
+    [VM_OC_FOR_OF_HAS_NEXT] = &&vm_label_VM_OC_FOR_OF_HAS_NEXT,
+    [VM_OC_FOR_AWAIT_OF_INIT] = &&vm_label_VM_OC_FOR_AWAIT_OF_INIT,
+    [VM_OC_FOR_AWAIT_OF_HAS_NEXT] = &&vm_label_VM_OC_FOR_AWAIT_OF_HAS_NEXT,
+    [VM_OC_TRY] = &&vm_label_VM_OC_TRY,
+    [VM_OC_CATCH] = &&vm_label_VM_OC_CATCH,
+    [VM_OC_FINALLY] = &&vm_label_VM_OC_FINALLY,
+    [VM_OC_CONTEXT_END] = &&vm_label_VM_OC_CONTEXT_END,
+    [VM_OC_JUMP_AND_EXIT_CONTEXT] = &&vm_label_VM_OC_JUMP_AND_EXIT_CONTEXT,
+#if JERRY_MODULE_SYSTEM
+    [VM_OC_MODULE_IMPORT] = &&vm_label_VM_OC_MODULE_IMPORT,
+    [VM_OC_MODULE_IMPORT_META] = &&vm_label_VM_OC_MODULE_IMPORT_META,
+#endif /* JERRY_MODULE_SYSTEM */
+#if JERRY_DEBUGGER
+    [VM_OC_BREAKPOINT_ENABLED] = &&vm_label_VM_OC_BREAKPOINT_ENABLED,
+    [VM_OC_BREAKPOINT_DISABLED] = &&vm_label_VM_OC_BREAKPOINT_DISABLED,
+#endif /* JERRY_DEBUGGER */
+    [VM_OC_NONE] = &&vm_label_VM_OC_NONE,
+  };
+  VM_GNU_EXTENSION_END
+#endif /* JERRY_VM_COMPUTED_GOTO */
+
   const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->shared_p->bytecode_header_p;
   const uint8_t *byte_code_p = frame_ctx_p->byte_code_p;
   ecma_value_t *literal_start_p = frame_ctx_p->literal_start_p;
@@ -980,8 +1656,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   uint16_t const_literal_end;
   int32_t branch_offset = 0;
   uint8_t branch_offset_length = 0;
-  ecma_value_t left_value;
-  ecma_value_t right_value;
+  ecma_value_t left_value = ECMA_VALUE_UNDEFINED;
+  ecma_value_t right_value = ECMA_VALUE_UNDEFINED;
   ecma_value_t result = ECMA_VALUE_EMPTY;
   bool is_strict = ((bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
 
@@ -1020,153 +1696,42 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     /* Internal loop for byte code execution. */
     while (true)
     {
-      const uint8_t *byte_code_start_p = byte_code_p;
-      uint8_t opcode = *byte_code_p++;
-      uint32_t opcode_data = opcode;
+      const uint8_t *byte_code_start_p;
+      uint8_t opcode;
+      uint32_t opcode_data;
 
-      if (opcode == CBC_EXT_OPCODE)
-      {
-        opcode = *byte_code_p++;
-        opcode_data = (uint32_t) ((CBC_END + 1) + opcode);
-      }
-
-      opcode_data = vm_decode_table[opcode_data];
+      VM_DECODE_INSTRUCTION ();
 
-      left_value = ECMA_VALUE_UNDEFINED;
-      right_value = ECMA_VALUE_UNDEFINED;
-
-      uint32_t operands = VM_OC_GET_ARGS_INDEX (opcode_data);
-
-      if (operands >= VM_OC_GET_LITERAL)
-      {
-        uint16_t literal_index;
-        READ_LITERAL_INDEX (literal_index);
-        READ_LITERAL (literal_index, left_value);
-
-        if (operands != VM_OC_GET_LITERAL)
-        {
-          switch (operands)
-          {
-            case VM_OC_GET_LITERAL_LITERAL:
-            {
-              uint16_t second_literal_index;
-              READ_LITERAL_INDEX (second_literal_index);
-              READ_LITERAL (second_literal_index, right_value);
-              break;
-            }
-            case VM_OC_GET_STACK_LITERAL:
-            {
-              JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
-              right_value = left_value;
-              left_value = *(--stack_top_p);
-              break;
-            }
-            default:
-            {
-              JERRY_ASSERT (operands == VM_OC_GET_THIS_LITERAL);
-
-              right_value = left_value;
-              left_value = ecma_copy_value (frame_ctx_p->this_binding);
-              break;
-            }
-          }
-        }
-      }
-      else if (operands >= VM_OC_GET_STACK)
-      {
-        JERRY_ASSERT (operands == VM_OC_GET_STACK || operands == VM_OC_GET_STACK_STACK);
-
-        JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
-        left_value = *(--stack_top_p);
-
-        if (operands == VM_OC_GET_STACK_STACK)
-        {
-          JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
-          right_value = left_value;
-          left_value = *(--stack_top_p);
-        }
-      }
-      else if (operands == VM_OC_GET_BRANCH)
-      {
-        branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
-        JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
-
-        branch_offset = *(byte_code_p++);
-
-        if (JERRY_UNLIKELY (branch_offset_length != 1))
-        {
-          branch_offset <<= 8;
-          branch_offset |= *(byte_code_p++);
-
-          if (JERRY_UNLIKELY (branch_offset_length == 3))
-          {
-            branch_offset <<= 8;
-            branch_offset |= *(byte_code_p++);
-          }
-        }
-
-        if (opcode_data & VM_OC_BACKWARD_BRANCH)
-        {
-#if JERRY_VM_HALT
-          if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
-          {
-            result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
-
-            if (ecma_is_value_undefined (result))
-            {
-              JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
-            }
-            else
-            {
-              JERRY_CONTEXT (vm_exec_stop_counter) = 1;
-
-              if (ecma_is_value_exception (result))
-              {
-                ecma_throw_exception (result);
-              }
-              else
-              {
-                jcontext_raise_exception (result);
-              }
-
-              JERRY_ASSERT (jcontext_has_pending_exception ());
-              jcontext_set_abort_flag (true);
-              result = ECMA_VALUE_ERROR;
-              goto error;
-            }
-          }
-#endif /* JERRY_VM_HALT */
-
-          branch_offset = -branch_offset;
-        }
-      }
+#if JERRY_VM_COMPUTED_GOTO
+      VM_GOTO_HANDLER ();
+#endif /* JERRY_VM_COMPUTED_GOTO */
 
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_POP:
+        VM_CASE (VM_OC_POP):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
           ecma_free_value (*(--stack_top_p));
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_POP_BLOCK:
+        VM_CASE (VM_OC_POP_BLOCK):
         {
           ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, 0));
           VM_GET_REGISTERS (frame_ctx_p)[0] = *(--stack_top_p);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH:
+        VM_CASE (VM_OC_PUSH):
         {
           *stack_top_p++ = left_value;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_TWO:
+        VM_CASE (VM_OC_PUSH_TWO):
         {
           *stack_top_p++ = left_value;
           *stack_top_p++ = right_value;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_THREE:
+        VM_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -1178,82 +1743,82 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           *stack_top_p++ = right_value;
           *stack_top_p++ = left_value;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_UNDEFINED:
+        VM_CASE (VM_OC_PUSH_UNDEFINED):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_TRUE:
+        VM_CASE (VM_OC_PUSH_TRUE):
         {
           *stack_top_p++ = ECMA_VALUE_TRUE;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_FALSE:
+        VM_CASE (VM_OC_PUSH_FALSE):
         {
           *stack_top_p++ = ECMA_VALUE_FALSE;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_NULL:
+        VM_CASE (VM_OC_PUSH_NULL):
         {
           *stack_top_p++ = ECMA_VALUE_NULL;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_THIS:
+        VM_CASE (VM_OC_PUSH_THIS):
         {
           *stack_top_p++ = ecma_copy_value (frame_ctx_p->this_binding);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_0:
+        VM_CASE (VM_OC_PUSH_0):
         {
           *stack_top_p++ = ecma_make_integer_value (0);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (number + 1);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (-(number + 1));
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_LIT_0:
+        VM_CASE (VM_OC_PUSH_LIT_0):
         {
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (0);
           stack_top_p += 2;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_LIT_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (number + 1);
           stack_top_p += 2;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_LIT_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (-(number + 1));
           stack_top_p += 2;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *obj_p =
             ecma_create_object (ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE), 0, ECMA_OBJECT_TYPE_GENERAL);
 
           *stack_top_p++ = ecma_make_object_value (obj_p);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_NAMED_FUNC_EXPR:
+        VM_CASE (VM_OC_PUSH_NAMED_FUNC_EXPR):
         {
           ecma_object_t *func_p = ecma_get_object_from_value (left_value);
 
@@ -1269,13 +1834,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_op_create_immutable_binding (name_lex_env, ecma_get_string_from_value (right_value), left_value);
 
           ECMA_SET_NON_NULL_POINTER_TAG (ext_func_p->u.function.scope_cp, name_lex_env, 0);
+          ecma_gc_write_barrier ((ecma_object_t *) ext_func_p, name_lex_env);
 
           ecma_free_value (right_value);
           ecma_deref_object (name_lex_env);
           *stack_top_p++ = left_value;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_CREATE_BINDING:
+        VM_CASE (VM_OC_CREATE_BINDING):
         {
           uint32_t literal_index;
 
@@ -1305,9 +1871,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             property_value_p->value = ECMA_VALUE_UNINITIALIZED;
           }
 
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_VAR_EVAL:
+        VM_CASE (VM_OC_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1384,6 +1950,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               JERRY_ASSERT (ecma_is_value_undefined (ECMA_PROPERTY_VALUE_PTR (prop_p)->value));
               JERRY_ASSERT (ecma_is_property_writable (*prop_p));
               ECMA_PROPERTY_VALUE_PTR (prop_p)->value = lit_value;
+              ecma_gc_write_barrier_value (lex_env_p, lit_value);
               ecma_free_object (lit_value);
             }
             else
@@ -1397,9 +1964,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               }
             }
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_EXT_VAR_EVAL:
+        VM_CASE (VM_OC_EXT_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1452,14 +2019,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             if (lit_value == ECMA_VALUE_UNDEFINED)
             {
-              continue;
+              VM_DISPATCH ();
             }
           }
           else
           {
             if (lit_value == ECMA_VALUE_UNDEFINED)
             {
-              continue;
+              VM_DISPATCH ();
             }
 
             property_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
@@ -1467,10 +2034,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           property_value_p->value = lit_value;
+          ecma_gc_write_barrier_value (prev_lex_env_p, lit_value);
           ecma_deref_object (ecma_get_object_from_value (lit_value));
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_CREATE_ARGUMENTS:
+        VM_CASE (VM_OC_CREATE_ARGUMENTS):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1484,7 +2052,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             JERRY_ASSERT (VM_GET_REGISTER (frame_ctx_p, literal_index) == ECMA_VALUE_UNDEFINED);
             VM_GET_REGISTER (frame_ctx_p, literal_index) = result;
-            continue;
+            VM_DISPATCH ();
           }
 
           ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -1496,19 +2064,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           property_value_p = ecma_create_named_data_property (frame_ctx_p->lex_env_p, name_p, prop_attributes, NULL);
           property_value_p->value = result;
+          ecma_gc_write_barrier_value (frame_ctx_p->lex_env_p, result);
 
           ecma_deref_object (ecma_get_object_from_value (result));
-          continue;
+          VM_DISPATCH ();
         }
 #if JERRY_SNAPSHOT_EXEC
-        case VM_OC_SET_BYTECODE_PTR:
+        VM_CASE (VM_OC_SET_BYTECODE_PTR):
         {
           memcpy (&byte_code_p, byte_code_p++, sizeof (uintptr_t));
           frame_ctx_p->byte_code_start_p = byte_code_p;
-          continue;
+          VM_DISPATCH ();
         }
 #endif /* JERRY_SNAPSHOT_EXEC */
-        case VM_OC_INIT_ARG_OR_FUNC:
+        VM_CASE (VM_OC_INIT_ARG_OR_FUNC):
         {
           uint32_t literal_index, value_index;
           ecma_value_t lit_value;
@@ -1519,7 +2088,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (value_index < register_end)
           {
             /* Take (not copy) the reference. */
-            lit_value = ecma_copy_value_if_not_object (VM_GET_REGISTER (frame_ctx_p, value_index));
+            lit_value =
+              ecma_copy_value_if_not_object (frame_ctx_p->lex_env_p, VM_GET_REGISTER (frame_ctx_p, value_index));
           }
           else
           {
@@ -1537,7 +2107,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, literal_index));
             JERRY_ASSERT (release);
             VM_GET_REGISTER (frame_ctx_p, literal_index) = lit_value;
-            continue;
+            VM_DISPATCH ();
           }
 
           ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -1551,14 +2121,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (property_value_p->value == ECMA_VALUE_UNDEFINED);
           property_value_p->value = lit_value;
+          ecma_gc_write_barrier_value (frame_ctx_p->lex_env_p, lit_value);
 
           if (release)
           {
             ecma_deref_object (ecma_get_object_from_value (lit_value));
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_CHECK_VAR:
+        VM_CASE (VM_OC_CHECK_VAR):
         {
           JERRY_ASSERT (CBC_FUNCTION_GET_TYPE (frame_ctx_p->shared_p->bytecode_header_p->status_flags)
                         == CBC_FUNCTION_SCRIPT);
@@ -1568,7 +2139,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           if ((frame_ctx_p->lex_env_p->type_flags_refs & ECMA_OBJECT_FLAG_BLOCK) == 0)
           {
-            continue;
+            VM_DISPATCH ();
           }
 
           ecma_string_t *const literal_name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -1580,9 +2151,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_CHECK_LET:
+        VM_CASE (VM_OC_CHECK_LET):
         {
           JERRY_ASSERT (CBC_FUNCTION_GET_TYPE (frame_ctx_p->shared_p->bytecode_header_p->status_flags)
                         == CBC_FUNCTION_SCRIPT);
@@ -1608,7 +2179,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               goto error;
             }
 
-            continue;
+            VM_DISPATCH ();
           }
 
           result = ecma_op_has_binding (lex_env_p, literal_name_p);
@@ -1626,9 +2197,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_ASSIGN_LET_CONST:
+        VM_CASE (VM_OC_ASSIGN_LET_CONST):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1646,14 +2217,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p)->value == ECMA_VALUE_UNINITIALIZED);
 
           ECMA_PROPERTY_VALUE_PTR (property_p)->value = left_value;
+          ecma_gc_write_barrier_value (frame_ctx_p->lex_env_p, left_value);
 
           if (ecma_is_value_object (left_value))
           {
             ecma_deref_object (ecma_get_object_from_value (left_value));
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_INIT_BINDING:
+        VM_CASE (VM_OC_INIT_BINDING):
         {
           uint32_t literal_index;
 
@@ -1685,15 +2257,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_value_t value = *(--stack_top_p);
 
           property_value_p->value = value;
+          ecma_gc_write_barrier_value (frame_ctx_p->lex_env_p, value);
           ecma_deref_if_object (value);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_THROW_CONST_ERROR:
+        VM_CASE (VM_OC_THROW_CONST_ERROR):
         {
           result = ecma_raise_type_error (ECMA_ERR_CONSTANT_BINDINGS_CANNOT_BE_REASSIGNED);
           goto error;
         }
-        case VM_OC_COPY_TO_GLOBAL:
+        VM_CASE (VM_OC_COPY_TO_GLOBAL):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1747,7 +2320,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_COPY_FROM_ARG:
+        VM_CASE (VM_OC_COPY_FROM_ARG):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1769,18 +2342,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (property_p != NULL);
 
           ecma_property_value_t *arg_prop_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
-          property_value_p->value = ecma_copy_value_if_not_object (arg_prop_value_p->value);
-          continue;
+          property_value_p->value = ecma_copy_value_if_not_object (lex_env_p, arg_prop_value_p->value);
+          VM_DISPATCH ();
         }
-        case VM_OC_CLONE_CONTEXT:
+        VM_CASE (VM_OC_CLONE_CONTEXT):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE);
 
           bool copy_values = (byte_code_start_p[1] == CBC_EXT_CLONE_FULL_CONTEXT);
           frame_ctx_p->lex_env_p = ecma_clone_decl_lexical_environment (frame_ctx_p->lex_env_p, copy_values);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_SET__PROTO__:
+        VM_CASE (VM_OC_SET__PROTO__):
         {
           result = ecma_builtin_object_object_set_proto (stack_top_p[-1], left_value);
           if (ECMA_IS_VALUE_ERROR (result))
@@ -1789,7 +2362,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_CLASS_CALL_STATIC_BLOCK:
+        VM_CASE (VM_OC_CLASS_CALL_STATIC_BLOCK):
         {
           result = ecma_op_function_call (ecma_get_object_from_value (left_value), frame_ctx_p->this_binding, NULL, 0);
 
@@ -1799,7 +2372,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_PUSH_STATIC_FIELD_FUNC:
+        VM_CASE (VM_OC_PUSH_STATIC_FIELD_FUNC):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE
                         && (byte_code_start_p[1] == CBC_EXT_PUSH_STATIC_FIELD_FUNC
@@ -1822,13 +2395,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           if (!push_computed)
           {
-            continue;
+            VM_DISPATCH ();
           }
 
           left_value = value;
           /* FALLTHRU */
         }
-        case VM_OC_ADD_COMPUTED_FIELD:
+        VM_CASE (VM_OC_ADD_COMPUTED_FIELD):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE
                         && (byte_code_start_p[1] == CBC_EXT_PUSH_STATIC_COMPUTED_FIELD_FUNC
@@ -1844,13 +2417,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_COPY_DATA_PROPERTIES:
+        VM_CASE (VM_OC_COPY_DATA_PROPERTIES):
         {
           left_value = *(--stack_top_p);
 
           if (ecma_is_value_undefined (left_value) || ecma_is_value_null (left_value))
           {
-            continue;
+            VM_DISPATCH ();
           }
 
           result = opfunc_copy_data_properties (stack_top_p[-1], left_value, ECMA_VALUE_UNDEFINED);
@@ -1862,7 +2435,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_SET_COMPUTED_PROPERTY:
+        VM_CASE (VM_OC_SET_COMPUTED_PROPERTY):
         {
           /* Swap values. */
           left_value ^= right_value;
@@ -1870,7 +2443,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value ^= right_value;
           /* FALLTHRU */
         }
-        case VM_OC_SET_PROPERTY:
+        VM_CASE (VM_OC_SET_PROPERTY):
         {
           JERRY_STATIC_ASSERT (VM_OC_NON_STATIC_FLAG == VM_OC_BACKWARD_BRANCH,
                                vm_oc_non_static_flag_must_be_equal_to_vm_oc_backward_branch);
@@ -1901,8 +2474,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_CASE (VM_OC_SET_GETTER):
+        VM_CASE (VM_OC_SET_SETTER):
         {
           JERRY_ASSERT ((opcode_data >> VM_OC_NON_STATIC_SHIFT) <= 0x1);
 
@@ -1931,20 +2504,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_CASE (VM_OC_PUSH_ARRAY):
         {
           /* Note: this operation cannot throw an exception */
           *stack_top_p++ = ecma_make_object_value (ecma_op_new_array_object (0));
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_LOCAL_EVAL:
+        VM_CASE (VM_OC_LOCAL_EVAL):
         {
           ECMA_CLEAR_LOCAL_PARSE_OPTS ();
           uint8_t parse_opts = *byte_code_p++;
           ECMA_SET_LOCAL_PARSE_OPTS (parse_opts);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_SUPER_CALL:
+        VM_CASE (VM_OC_SUPER_CALL):
         {
           uint8_t arguments_list_len = *byte_code_p++;
 
@@ -1972,20 +2545,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_PUSH_CLASS_ENVIRONMENT:
+        VM_CASE (VM_OC_PUSH_CLASS_ENVIRONMENT):
         {
           uint16_t literal_index;
 
           READ_LITERAL_INDEX (literal_index);
           opfunc_push_class_environment (frame_ctx_p, &stack_top_p, literal_start_p[literal_index]);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_IMPLICIT_CTOR:
+        VM_CASE (VM_OC_PUSH_IMPLICIT_CTOR):
         {
           *stack_top_p++ = opfunc_create_implicit_class_constructor (opcode, frame_ctx_p->shared_p->bytecode_header_p);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_DEFINE_FIELD:
+        VM_CASE (VM_OC_DEFINE_FIELD):
         {
           result = opfunc_define_field (frame_ctx_p->this_binding, right_value, left_value);
 
@@ -1996,7 +2569,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_ASSIGN_PRIVATE:
+        VM_CASE (VM_OC_ASSIGN_PRIVATE):
         {
           result = opfunc_private_set (stack_top_p[-3], stack_top_p[-2], stack_top_p[-1]);
 
@@ -2026,7 +2599,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_FIELD_ADD:
+        VM_CASE (VM_OC_PRIVATE_FIELD_ADD):
         {
           result = opfunc_private_field_add (frame_ctx_p->this_binding, right_value, left_value);
 
@@ -2037,7 +2610,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_PROP_GET:
+        VM_CASE (VM_OC_PRIVATE_PROP_GET):
         {
           result = opfunc_private_get (left_value, right_value);
 
@@ -2049,7 +2622,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_PROP_REFERENCE:
+        VM_CASE (VM_OC_PRIVATE_PROP_REFERENCE):
         {
           result = opfunc_private_get (stack_top_p[-1], left_value);
 
@@ -2060,9 +2633,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           *stack_top_p++ = left_value;
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PRIVATE_IN:
+        VM_CASE (VM_OC_PRIVATE_IN):
         {
           result = opfunc_private_in (left_value, right_value);
 
@@ -2074,12 +2647,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_COLLECT_PRIVATE_PROPERTY:
+        VM_CASE (VM_OC_COLLECT_PRIVATE_PROPERTY):
         {
           opfunc_collect_private_properties (stack_top_p[-2], left_value, right_value, opcode);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_INIT_CLASS:
+        VM_CASE (VM_OC_INIT_CLASS):
         {
           result = opfunc_init_class (frame_ctx_p, stack_top_p);
 
@@ -2087,9 +2660,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             goto error;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FINALIZE_CLASS:
+        VM_CASE (VM_OC_FINALIZE_CLASS):
         {
           JERRY_ASSERT (opcode == CBC_EXT_FINALIZE_NAMED_CLASS || opcode == CBC_EXT_FINALIZE_ANONYMOUS_CLASS);
 
@@ -2101,9 +2674,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           opfunc_finalize_class (frame_ctx_p, &stack_top_p, left_value);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_SET_FIELD_INIT:
+        VM_CASE (VM_OC_SET_FIELD_INIT):
         {
           ecma_string_t *property_name_p = ecma_get_magic_string (LIT_INTERNAL_MAGIC_STRING_CLASS_FIELD_INIT);
           ecma_object_t *proto_object_p = ecma_get_object_from_value (stack_top_p[-1]);
@@ -2115,6 +2688,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_property_value_t *property_value_p =
             ecma_create_named_data_property (class_object_p, property_name_p, ECMA_PROPERTY_FIXED, NULL);
           property_value_p->value = left_value;
+          ecma_gc_write_barrier_value (class_object_p, left_value);
 
           property_name_p = ecma_get_internal_string (LIT_INTERNAL_MAGIC_STRING_CLASS_FIELD_COMPUTED);
           ecma_property_t *property_p = ecma_find_named_property (class_object_p, property_name_p);
@@ -2130,7 +2704,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_RUN_FIELD_INIT:
+        VM_CASE (VM_OC_RUN_FIELD_INIT):
         {
           JERRY_ASSERT (frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_NON_ARROW_FUNC);
           result = opfunc_init_class_fields (frame_ctx_p->shared_p->function_object_p, frame_ctx_p->this_binding);
@@ -2139,9 +2713,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             goto error;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_RUN_STATIC_FIELD_INIT:
+        VM_CASE (VM_OC_RUN_STATIC_FIELD_INIT):
         {
           left_value = stack_top_p[-2];
           stack_top_p[-2] = stack_top_p[-1];
@@ -2155,7 +2729,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_SET_NEXT_COMPUTED_FIELD:
+        VM_CASE (VM_OC_SET_NEXT_COMPUTED_FIELD):
         {
           ecma_integer_value_t next_index = ecma_get_integer_from_value (stack_top_p[-2]) + 1;
           stack_top_p[-2] = ecma_make_integer_value (next_index);
@@ -2193,9 +2767,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           ecma_free_value (*(--stack_top_p));
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_SUPER_CONSTRUCTOR:
+        VM_CASE (VM_OC_PUSH_SUPER_CONSTRUCTOR):
         {
           result = ecma_op_function_get_super_constructor (vm_get_class_function (frame_ctx_p));
 
@@ -2205,9 +2779,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_RESOLVE_LEXICAL_THIS:
+        VM_CASE (VM_OC_RESOLVE_LEXICAL_THIS):
         {
           result = ecma_op_get_this_binding (frame_ctx_p->lex_env_p);
 
@@ -2217,9 +2791,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_OBJECT_LITERAL_HOME_ENV:
+        VM_CASE (VM_OC_OBJECT_LITERAL_HOME_ENV):
         {
           if (opcode == CBC_EXT_PUSH_OBJECT_SUPER_ENVIRONMENT)
           {
@@ -2237,16 +2811,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p[-2] = stack_top_p[-1];
             stack_top_p--;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_SET_HOME_OBJECT:
+        VM_CASE (VM_OC_SET_HOME_OBJECT):
         {
           int offset = opcode == CBC_EXT_OBJECT_LITERAL_SET_HOME_OBJECT_COMPUTED ? -1 : 0;
           opfunc_set_home_object (ecma_get_object_from_value (stack_top_p[-1]),
                                   ecma_get_object_from_value (stack_top_p[-3 + offset]));
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_SUPER_REFERENCE:
+        VM_CASE (VM_OC_SUPER_REFERENCE):
         {
           result = opfunc_form_super_reference (&stack_top_p, frame_ctx_p, left_value, opcode);
 
@@ -2257,7 +2831,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_SET_FUNCTION_NAME:
+        VM_CASE (VM_OC_SET_FUNCTION_NAME):
         {
           char *prefix_p = NULL;
           lit_utf8_size_t prefix_size = 0;
@@ -2306,7 +2880,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (ecma_find_named_property (func_obj_p, ecma_get_magic_string (LIT_MAGIC_STRING_NAME)) != NULL)
           {
             ecma_free_value (left_value);
-            continue;
+            VM_DISPATCH ();
           }
 
           ecma_property_value_t *value_p;
@@ -2323,14 +2897,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           value_p->value =
             ecma_op_function_form_name (ecma_get_prop_name_from_value (left_value), prefix_p, prefix_size);
           ecma_free_value (left_value);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_SPREAD_ELEMENT:
+        VM_CASE (VM_OC_PUSH_SPREAD_ELEMENT):
         {
           *stack_top_p++ = ECMA_VALUE_SPREAD_ELEMENT;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_REST_OBJECT:
+        VM_CASE (VM_OC_PUSH_REST_OBJECT):
         {
           vm_frame_ctx_shared_t *shared_p = frame_ctx_p->shared_p;
 
@@ -2358,9 +2932,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (result));
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_ITERATOR_CONTEXT_CREATE:
+        VM_CASE (VM_OC_ITERATOR_CONTEXT_CREATE):
         {
           result = ecma_op_get_iterator (stack_top_p[-1], ECMA_VALUE_SYNC_ITERATOR, &left_value);
 
@@ -2378,9 +2952,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-2] = result;
           stack_top_p[-3] = left_value;
 
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_ITERATOR_STEP:
+        VM_CASE (VM_OC_ITERATOR_STEP):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
 
@@ -2415,9 +2989,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = value;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_ITERATOR_CONTEXT_END:
+        VM_CASE (VM_OC_ITERATOR_CONTEXT_END):
         {
           JERRY_ASSERT (VM_LAST_CONTEXT_END () == stack_top_p);
 
@@ -2434,22 +3008,22 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           stack_top_p =
             vm_stack_context_abort_variable_length (frame_ctx_p, stack_top_p, PARSER_ITERATOR_CONTEXT_STACK_ALLOCATION);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_DEFAULT_INITIALIZER:
+        VM_CASE (VM_OC_DEFAULT_INITIALIZER):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
 
           if (stack_top_p[-1] != ECMA_VALUE_UNDEFINED)
           {
             byte_code_p = byte_code_start_p + branch_offset;
-            continue;
+            VM_DISPATCH ();
           }
 
           stack_top_p--;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_REST_INITIALIZER:
+        VM_CASE (VM_OC_REST_INITIALIZER):
         {
           ecma_object_t *array_p = ecma_op_new_array_object (0);
           JERRY_ASSERT (ecma_op_object_is_fast_array (array_p));
@@ -2492,9 +3066,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = ecma_make_object_value (array_p);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_OBJ_INIT_CONTEXT_CREATE:
+        VM_CASE (VM_OC_OBJ_INIT_CONTEXT_CREATE):
         {
           left_value = stack_top_p[-1];
           vm_stack_context_type_t context_type = VM_CONTEXT_OBJ_INIT;
@@ -2517,9 +3091,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             stack_top_p[-3] = ecma_make_object_value (ecma_op_new_array_object (0));
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_OBJ_INIT_CONTEXT_END:
+        VM_CASE (VM_OC_OBJ_INIT_CONTEXT_END):
         {
           JERRY_ASSERT (stack_top_p == VM_LAST_CONTEXT_END ());
 
@@ -2531,9 +3105,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           stack_top_p = vm_stack_context_abort_variable_length (frame_ctx_p, stack_top_p, context_stack_allocation);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_OBJ_INIT_PUSH_REST:
+        VM_CASE (VM_OC_OBJ_INIT_PUSH_REST):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
           if (!ecma_op_require_object_coercible (last_context_end_p[-2]))
@@ -2558,9 +3132,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           last_context_end_p[-2] = ECMA_VALUE_UNDEFINED;
 
           *stack_top_p++ = left_value;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_INITIALIZER_PUSH_NAME:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_NAME):
         {
           if (JERRY_UNLIKELY (!ecma_is_value_prop_name (left_value)))
           {
@@ -2584,7 +3158,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_fast_array_set_property (array_obj_p, ext_array_obj_p->u.array.length, left_value);
           /* FALLTHRU */
         }
-        case VM_OC_INITIALIZER_PUSH_PROP:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_PROP):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
           ecma_value_t base = last_context_end_p[-2];
@@ -2600,7 +3174,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p--;
           }
 
-          result = vm_op_get_value (base, left_value);
+          result = vm_op_get_value (base, left_value, byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2610,7 +3184,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_SPREAD_ARGUMENTS:
+        VM_CASE (VM_OC_SPREAD_ARGUMENTS):
         {
           uint8_t arguments_list_len = *byte_code_p++;
           stack_top_p -= arguments_list_len;
@@ -2631,7 +3205,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_CREATE_GENERATOR:
+        VM_CASE (VM_OC_CREATE_GENERATOR):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
@@ -2642,14 +3216,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           return ecma_make_object_value ((ecma_object_t *) executable_object_p);
         }
-        case VM_OC_YIELD:
+        VM_CASE (VM_OC_YIELD):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
           frame_ctx_p->stack_top_p = --stack_top_p;
           return *stack_top_p;
         }
-        case VM_OC_ASYNC_YIELD:
+        VM_CASE (VM_OC_ASYNC_YIELD):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2660,7 +3234,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = --stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ASYNC_YIELD_ITERATOR:
+        VM_CASE (VM_OC_ASYNC_YIELD_ITERATOR):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2700,7 +3274,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_AWAIT:
+        VM_CASE (VM_OC_AWAIT):
         {
           if (JERRY_UNLIKELY (!(frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_EXECUTABLE)))
           {
@@ -2718,7 +3292,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_GENERATOR_AWAIT:
+        VM_CASE (VM_OC_GENERATOR_AWAIT):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2734,7 +3308,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_EXT_RETURN:
+        VM_CASE (VM_OC_EXT_RETURN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
@@ -2748,7 +3322,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_ASYNC_EXIT:
+        VM_CASE (VM_OC_ASYNC_EXIT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2791,7 +3365,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->call_operation = VM_NO_EXEC_OP;
           return result;
         }
-        case VM_OC_STRING_CONCAT:
+        VM_CASE (VM_OC_STRING_CONCAT):
         {
           ecma_string_t *left_str_p = ecma_op_to_string (left_value);
 
@@ -2815,16 +3389,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_string_value (result_str_p);
           goto free_both_values;
         }
-        case VM_OC_GET_TEMPLATE_OBJECT:
+        VM_CASE (VM_OC_GET_TEMPLATE_OBJECT):
         {
           uint8_t tagged_idx = *byte_code_p++;
           ecma_collection_t *collection_p = ecma_compiled_code_get_tagged_template_collection (bytecode_header_p);
           JERRY_ASSERT (tagged_idx < collection_p->item_count);
 
           *stack_top_p++ = ecma_copy_value (collection_p->buffer_p[tagged_idx]);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_NEW_TARGET:
+        VM_CASE (VM_OC_PUSH_NEW_TARGET):
         {
           ecma_object_t *new_target_object_p = JERRY_CONTEXT (current_new_target_p);
           if (new_target_object_p == NULL)
@@ -2836,18 +3410,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_ref_object (new_target_object_p);
             *stack_top_p++ = ecma_make_object_value (new_target_object_p);
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_REQUIRE_OBJECT_COERCIBLE:
+        VM_CASE (VM_OC_REQUIRE_OBJECT_COERCIBLE):
         {
           if (!ecma_op_require_object_coercible (stack_top_p[-1]))
           {
             result = ECMA_VALUE_ERROR;
             goto error;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_ASSIGN_SUPER:
+        VM_CASE (VM_OC_ASSIGN_SUPER):
         {
           result = opfunc_assign_super_reference (&stack_top_p, frame_ctx_p, opcode_data);
 
@@ -2855,14 +3429,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             goto error;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PUSH_ELISON:
+        VM_CASE (VM_OC_PUSH_ELISON):
         {
           *stack_top_p++ = ECMA_VALUE_ARRAY_HOLE;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_CASE (VM_OC_APPEND_ARRAY):
         {
           uint16_t values_length = *byte_code_p++;
           stack_top_p -= values_length;
@@ -2878,9 +3452,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -2913,11 +3487,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             *stack_top_p++ = ecma_make_string_value (name_p);
             *stack_top_p++ = result;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PROP_GET:
+        VM_CASE (VM_OC_PROP_GET):
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (left_value, right_value, byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2927,7 +3501,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -2951,12 +3525,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_CASE (VM_OC_PROP_PRE_INCR):
+        VM_CASE (VM_OC_PROP_PRE_DECR):
+        VM_CASE (VM_OC_PROP_POST_INCR):
+        VM_CASE (VM_OC_PROP_POST_DECR):
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (left_value, right_value, byte_code_start_p);
 
           if (opcode < CBC_PRE_INCR)
           {
@@ -2979,10 +3553,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = ECMA_VALUE_UNDEFINED;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_CASE (VM_OC_PRE_INCR):
+        VM_CASE (VM_OC_PRE_DECR):
+        VM_CASE (VM_OC_POST_INCR):
+        VM_CASE (VM_OC_POST_DECR):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
           ecma_number_t result_number;
@@ -3102,13 +3676,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_CASE (VM_OC_ASSIGN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_MOV_IDENT:
+        VM_CASE (VM_OC_MOV_IDENT):
         {
           uint32_t literal_index;
 
@@ -3119,16 +3693,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, literal_index));
           VM_GET_REGISTER (frame_ctx_p, literal_index) = left_value;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_CASE (VM_OC_ASSIGN_PROP):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_copy_value (frame_ctx_p->this_binding);
@@ -3136,7 +3710,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_RETURN_FUNCTION_END:
+        VM_CASE (VM_OC_RETURN_FUNCTION_END):
         {
           if (CBC_FUNCTION_GET_TYPE (bytecode_header_p->status_flags) == CBC_FUNCTION_SCRIPT)
           {
@@ -3150,7 +3724,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_RETURN:
+        VM_CASE (VM_OC_RETURN):
         {
           JERRY_ASSERT (opcode == CBC_RETURN || opcode == CBC_RETURN_WITH_LITERAL);
 
@@ -3158,7 +3732,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_CASE (VM_OC_THROW):
         {
           jcontext_raise_exception (left_value);
 
@@ -3166,31 +3740,31 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           result = ecma_raise_reference_error (ECMA_ERR_UNDEFINED_REFERENCE);
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_CASE (VM_OC_EVAL):
         {
           JERRY_CONTEXT (status_flags) |= ECMA_STATUS_DIRECT_EVAL;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_CALL:
+        VM_CASE (VM_OC_CALL):
         {
           frame_ctx_p->call_operation = VM_EXEC_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_NEW:
+        VM_CASE (VM_OC_NEW):
         {
           frame_ctx_p->call_operation = VM_EXEC_CONSTRUCT;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ERROR:
+        VM_CASE (VM_OC_ERROR):
         {
           JERRY_ASSERT (frame_ctx_p->byte_code_p[1] == CBC_EXT_ERROR);
 #if JERRY_DEBUGGER
@@ -3200,7 +3774,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = ECMA_VALUE_ERROR;
           goto error;
         }
-        case VM_OC_RESOLVE_BASE_FOR_CALL:
+        VM_CASE (VM_OC_RESOLVE_BASE_FOR_CALL):
         {
           ecma_value_t this_value = stack_top_p[-3];
 
@@ -3216,9 +3790,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p[-3] = this_value;
           }
 
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PROP_DELETE:
+        VM_CASE (VM_OC_PROP_DELETE):
         {
           result = vm_op_delete_prop (left_value, right_value, is_strict);
 
@@ -3232,7 +3806,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DELETE:
+        VM_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -3241,7 +3815,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (literal_index < register_end)
           {
             *stack_top_p++ = ECMA_VALUE_FALSE;
-            continue;
+            VM_DISPATCH ();
           }
 
           result = vm_op_delete_var (literal_start_p[literal_index], frame_ctx_p->lex_env_p);
@@ -3254,14 +3828,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (ecma_is_value_boolean (result));
 
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_JUMP:
+        VM_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3273,12 +3847,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_free_value (*--stack_top_p);
           }
           ecma_free_value (value);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
           ecma_value_t value = *(--stack_top_p);
@@ -3297,14 +3871,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             {
               /* "Push" the value back to the stack. */
               ++stack_top_p;
-              continue;
+              VM_DISPATCH ();
             }
           }
 
           ecma_fast_free_value (value);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_BRANCH_OPTIONAL_CHAIN:
+        VM_CASE (VM_OC_BRANCH_OPTIONAL_CHAIN):
         {
           left_value = stack_top_p[-1];
 
@@ -3317,7 +3891,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               byte_code_p += 2;
             }
 
-            continue;
+            VM_DISPATCH ();
           }
 
           stack_top_p[-1] = ECMA_VALUE_UNDEFINED;
@@ -3325,32 +3899,32 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           if (!pop_reference)
           {
-            continue;
+            VM_DISPATCH ();
           }
           /* FALLTHRU */
         }
-        case VM_OC_POP_REFERENCE:
+        VM_CASE (VM_OC_POP_REFERENCE):
         {
           ecma_free_value (stack_top_p[-2]);
           ecma_free_value (stack_top_p[-3]);
           stack_top_p[-3] = stack_top_p[-1];
           stack_top_p -= 2;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_BRANCH_IF_NULLISH:
+        VM_CASE (VM_OC_BRANCH_IF_NULLISH):
         {
           left_value = stack_top_p[-1];
 
           if (!ecma_is_value_null (left_value) && !ecma_is_value_undefined (left_value))
           {
             byte_code_p = byte_code_start_p + branch_offset;
-            continue;
+            VM_DISPATCH ();
           }
           --stack_top_p;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_PLUS:
-        case VM_OC_MINUS:
+        VM_CASE (VM_OC_PLUS):
+        VM_CASE (VM_OC_MINUS):
         {
           result = opfunc_unary_operation (left_value, VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS);
 
@@ -3362,13 +3936,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_NOT:
+        VM_CASE (VM_OC_NOT):
         {
           *stack_top_p++ = ecma_make_boolean_value (!ecma_op_to_boolean (left_value));
           JERRY_ASSERT (ecma_is_value_boolean (stack_top_p[-1]));
           goto free_left_value;
         }
-        case VM_OC_BIT_NOT:
+        VM_CASE (VM_OC_BIT_NOT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3389,12 +3963,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_VOID:
+        VM_CASE (VM_OC_VOID):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           goto free_left_value;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -3428,7 +4002,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_CASE (VM_OC_TYPEOF):
         {
           result = opfunc_typeof (left_value);
 
@@ -3440,14 +4014,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_ADD:
+        VM_CASE (VM_OC_ADD):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer + right_integer));
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_float_number (left_value) && ecma_is_value_number (right_value))
@@ -3457,7 +4031,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_float_number (right_value) && ecma_is_value_integer_number (left_value))
@@ -3466,7 +4040,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               ((ecma_number_t) ecma_get_integer_from_value (left_value) + ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            VM_DISPATCH ();
           }
 
           result = opfunc_addition (left_value, right_value);
@@ -3479,7 +4053,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_SUB:
+        VM_CASE (VM_OC_SUB):
         {
           JERRY_STATIC_ASSERT (ECMA_INTEGER_NUMBER_MAX * 2 <= INT32_MAX && ECMA_INTEGER_NUMBER_MIN * 2 >= INT32_MIN,
                                doubled_ecma_numbers_must_fit_into_int32_range);
@@ -3491,7 +4065,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer - right_integer));
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_float_number (left_value) && ecma_is_value_number (right_value))
@@ -3501,7 +4075,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_float_number (right_value) && ecma_is_value_integer_number (left_value))
@@ -3510,7 +4084,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               ((ecma_number_t) ecma_get_integer_from_value (left_value) - ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            VM_DISPATCH ();
           }
 
           result = do_number_arithmetic (NUMBER_ARITHMETIC_SUBTRACTION, left_value, right_value);
@@ -3523,7 +4097,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MUL:
+        VM_CASE (VM_OC_MUL):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
@@ -3541,12 +4115,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 && left_integer != 0 && right_integer != 0)
             {
               *stack_top_p++ = ecma_integer_multiply (left_integer, right_integer);
-              continue;
+              VM_DISPATCH ();
             }
 
             ecma_number_t multiply = (ecma_number_t) left_integer * (ecma_number_t) right_integer;
             *stack_top_p++ = ecma_make_number_value (multiply);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_float_number (left_value) && ecma_is_value_number (right_value))
@@ -3556,7 +4130,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_float_number (right_value) && ecma_is_value_integer_number (left_value))
@@ -3565,7 +4139,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               ((ecma_number_t) ecma_get_integer_from_value (left_value) * ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            VM_DISPATCH ();
           }
 
           result = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION, left_value, right_value);
@@ -3578,7 +4152,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DIV:
+        VM_CASE (VM_OC_DIV):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
@@ -3592,7 +4166,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MOD:
+        VM_CASE (VM_OC_MOD):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
@@ -3608,7 +4182,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               if (mod_result != 0 || left_integer >= 0)
               {
                 *stack_top_p++ = ecma_make_integer_value (mod_result);
-                continue;
+                VM_DISPATCH ();
               }
             }
           }
@@ -3623,7 +4197,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_EXP:
+        VM_CASE (VM_OC_EXP):
         {
           result = do_number_arithmetic (NUMBER_ARITHMETIC_EXPONENTIATION, left_value, right_value);
 
@@ -3635,7 +4209,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_EQUAL:
+        VM_CASE (VM_OC_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3647,7 +4221,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_NOT_EQUAL:
+        VM_CASE (VM_OC_NOT_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3659,7 +4233,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_invert_boolean_value (result);
           goto free_both_values;
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_CASE (VM_OC_STRICT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -3668,7 +4242,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -3677,7 +4251,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_OR:
+        VM_CASE (VM_OC_BIT_OR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3685,7 +4259,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             *stack_top_p++ = left_value | right_value;
-            continue;
+            VM_DISPATCH ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR, left_value, right_value);
@@ -3698,7 +4272,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_XOR:
+        VM_CASE (VM_OC_BIT_XOR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3706,7 +4280,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             *stack_top_p++ = left_value ^ right_value;
-            continue;
+            VM_DISPATCH ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR, left_value, right_value);
@@ -3719,7 +4293,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_AND:
+        VM_CASE (VM_OC_BIT_AND):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3727,7 +4301,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             *stack_top_p++ = left_value & right_value;
-            continue;
+            VM_DISPATCH ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND, left_value, right_value);
@@ -3740,7 +4314,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_CASE (VM_OC_LEFT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3751,7 +4325,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
 
             *stack_top_p++ = ecma_make_int32_value ((int32_t) ((uint32_t) left_integer << (right_integer & 0x1f)));
-            continue;
+            VM_DISPATCH ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT, left_value, right_value);
@@ -3764,7 +4338,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_CASE (VM_OC_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3774,7 +4348,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_integer_value (left_integer >> (right_integer & 0x1f));
-            continue;
+            VM_DISPATCH ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT, left_value, right_value);
@@ -3787,7 +4361,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3797,7 +4371,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             uint32_t left_uint32 = (uint32_t) ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_uint32_value (left_uint32 >> (right_integer & 0x1f));
-            continue;
+            VM_DISPATCH ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT, left_value, right_value);
@@ -3810,7 +4384,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS:
+        VM_CASE (VM_OC_LESS):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3847,11 +4421,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 byte_code_p += branch_offset_length;
               }
 
-              continue;
+              VM_DISPATCH ();
             }
 #endif /* !JERRY_VM_HALT */
             *stack_top_p++ = ecma_make_boolean_value (is_less);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
@@ -3873,7 +4447,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER:
+        VM_CASE (VM_OC_GREATER):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3881,7 +4455,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
             *stack_top_p++ = ecma_make_boolean_value (left_integer > right_integer);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
@@ -3903,7 +4477,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS_EQUAL:
+        VM_CASE (VM_OC_LESS_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3911,7 +4485,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
             *stack_top_p++ = ecma_make_boolean_value (left_integer <= right_integer);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
@@ -3933,7 +4507,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_CASE (VM_OC_GREATER_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3941,7 +4515,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
             *stack_top_p++ = ecma_make_boolean_value (left_integer >= right_integer);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
@@ -3963,7 +4537,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_IN:
+        VM_CASE (VM_OC_IN):
         {
           result = opfunc_in (left_value, right_value);
 
@@ -3975,7 +4549,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_INSTANCEOF:
+        VM_CASE (VM_OC_INSTANCEOF):
         {
           result = opfunc_instanceof (left_value, right_value);
 
@@ -3987,7 +4561,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BLOCK_CREATE_CONTEXT:
+        VM_CASE (VM_OC_BLOCK_CREATE_CONTEXT):
         {
           ecma_value_t *stack_context_top_p;
           stack_context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
@@ -4027,9 +4601,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = ecma_create_decl_lex_env (frame_ctx_p->lex_env_p);
           frame_ctx_p->lex_env_p->type_flags_refs |= ECMA_OBJECT_FLAG_BLOCK;
 
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_WITH:
+        VM_CASE (VM_OC_WITH):
         {
           ecma_value_t value = *(--stack_top_p);
           ecma_object_t *object_p;
@@ -4059,9 +4633,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           with_env_p->type_flags_refs |= ECMA_OBJECT_FLAG_BLOCK;
           frame_ctx_p->lex_env_p = with_env_p;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FOR_IN_INIT:
+        VM_CASE (VM_OC_FOR_IN_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4081,7 +4655,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             /* The collection is already released */
             byte_code_p = byte_code_start_p + branch_offset;
-            continue;
+            VM_DISPATCH ();
           }
 
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -4099,9 +4673,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             byte_code_p += 2;
           }
 
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
 
@@ -4115,9 +4689,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           *stack_top_p++ = buffer_p[index];
           context_top_p[-3]++;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -4163,9 +4737,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             stack_top_p[-3] = index;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FOR_OF_INIT:
+        VM_CASE (VM_OC_FOR_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4196,7 +4770,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_free_value (iterator);
             ecma_free_value (next_method);
             byte_code_p = byte_code_start_p + branch_offset;
-            continue;
+            VM_DISPATCH ();
           }
 
           ecma_value_t next_value = ecma_op_iterator_value (result);
@@ -4224,9 +4798,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             /* No need to duplicate the first context. */
             byte_code_p += 2;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FOR_OF_GET_NEXT:
+        VM_CASE (VM_OC_FOR_OF_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_OF
@@ -4235,9 +4809,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           *stack_top_p++ = context_top_p[-2];
           context_top_p[-2] = ECMA_VALUE_UNDEFINED;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FOR_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_OF);
@@ -4258,7 +4832,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_free_value (stack_top_p[-4]);
             VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_OF_CONTEXT_STACK_ALLOCATION);
             stack_top_p -= PARSER_FOR_OF_CONTEXT_STACK_ALLOCATION;
-            continue;
+            VM_DISPATCH ();
           }
 
           ecma_value_t next_value = ecma_op_iterator_value (result);
@@ -4274,9 +4848,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] |= VM_CONTEXT_CLOSE_ITERATOR;
           stack_top_p[-2] = next_value;
           byte_code_p = byte_code_start_p + branch_offset;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FOR_AWAIT_OF_INIT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4347,7 +4921,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           return result;
         }
-        case VM_OC_FOR_AWAIT_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_AWAIT_OF);
@@ -4378,7 +4952,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_TRY:
+        VM_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -4389,18 +4963,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += PARSER_TRY_CONTEXT_STACK_ALLOCATION;
 
           stack_top_p[-1] = VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_CATCH:
+        VM_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_TRY);
 
           byte_code_p = byte_code_start_p + branch_offset;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_FINALLY:
+        VM_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -4422,9 +4996,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           stack_top_p[-1] = VM_CREATE_CONTEXT (VM_CONTEXT_FINALLY_JUMP, branch_offset);
           stack_top_p[-2] = (ecma_value_t) branch_offset;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_CONTEXT_END:
+        VM_CASE (VM_OC_CONTEXT_END):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!(stack_top_p[-1] & VM_CONTEXT_CLOSE_ITERATOR));
@@ -4436,7 +5010,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p = vm_stack_context_abort (frame_ctx_p, stack_top_p);
 
             JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
-            continue;
+            VM_DISPATCH ();
           }
 
           if (stack_top_p[-1] & VM_CONTEXT_HAS_LEX_ENV)
@@ -4507,9 +5081,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!jcontext_has_pending_exception ());
@@ -4549,10 +5123,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
-          continue;
+          VM_DISPATCH ();
         }
 #if JERRY_MODULE_SYSTEM
-        case VM_OC_MODULE_IMPORT:
+        VM_CASE (VM_OC_MODULE_IMPORT):
         {
           left_value = *(--stack_top_p);
 
@@ -4582,9 +5156,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_MODULE_IMPORT_META:
+        VM_CASE (VM_OC_MODULE_IMPORT_META):
         {
           ecma_value_t script_value = ((cbc_uint8_arguments_t *) bytecode_header_p)->script_value;
           cbc_script_t *script_p = ECMA_GET_INTERNAL_VALUE_POINTER (cbc_script_t, script_value);
@@ -4616,15 +5190,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = import_meta;
-          continue;
+          VM_DISPATCH ();
         }
 #endif /* JERRY_MODULE_SYSTEM */
 #if JERRY_DEBUGGER
-        case VM_OC_BREAKPOINT_ENABLED:
+        VM_CASE (VM_OC_BREAKPOINT_ENABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
-            continue;
+            VM_DISPATCH ();
           }
 
           JERRY_ASSERT (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED);
@@ -4639,13 +5213,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             result = ECMA_VALUE_ERROR;
             goto error;
           }
-          continue;
+          VM_DISPATCH ();
         }
-        case VM_OC_BREAKPOINT_DISABLED:
+        VM_CASE (VM_OC_BREAKPOINT_DISABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
-            continue;
+            VM_DISPATCH ();
           }
 
           JERRY_ASSERT (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED);
@@ -4664,20 +5238,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               result = ECMA_VALUE_ERROR;
               goto error;
             }
-            continue;
+            VM_DISPATCH ();
           }
 
           if (JERRY_CONTEXT (debugger_message_delay) > 0)
           {
             JERRY_CONTEXT (debugger_message_delay)--;
-            continue;
+            VM_DISPATCH ();
           }
 
           JERRY_CONTEXT (debugger_message_delay) = JERRY_DEBUGGER_MESSAGE_FREQUENCY;
 
           if (jerry_debugger_receive (NULL))
           {
-            continue;
+            VM_DISPATCH ();
           }
 
           if ((JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_STOP)
@@ -4691,10 +5265,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               goto error;
             }
           }
-          continue;
+          VM_DISPATCH ();
         }
 #endif /* JERRY_DEBUGGER */
-        case VM_OC_NONE:
+        VM_CASE (VM_OC_NONE):
         default:
         {
           JERRY_ASSERT (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_NONE);
@@ -4760,7 +5334,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_value_t set_value_result = vm_op_set_value (base, property, result, is_strict);
+          ecma_value_t set_value_result = vm_op_set_value (base, property, result, is_strict, byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (set_value_result))
           {
@@ -4791,6 +5365,9 @@ free_both_values:
       ecma_fast_free_value (right_value);
 free_left_value:
       ecma_fast_free_value (left_value);
+#if JERRY_VM_COMPUTED_GOTO
+      VM_DISPATCH ();
+#endif /* JERRY_VM_COMPUTED_GOTO */
     }
 
 error:
@@ -4995,6 +5572,7 @@ vm_init_module_scope (ecma_module_t *module_p) /**< module without scope */
   ((ecma_lexical_environment_class_t *) scope_p)->type = ECMA_LEX_ENV_CLASS_TYPE_MODULE;
 
   module_p->scope_p = scope_p;
+  ecma_gc_write_barrier ((ecma_object_t *) module_p, scope_p);
   ecma_deref_object (scope_p);
 
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
@@ -5112,6 +5690,7 @@ vm_init_module_scope (ecma_module_t *module_p) /**< module without scope */
 
         JERRY_ASSERT (property_value_p->value == ECMA_VALUE_UNDEFINED);
         property_value_p->value = ecma_make_object_value (function_obj_p);
+        ecma_gc_write_barrier (scope_p, function_obj_p);
         ecma_deref_object (function_obj_p);
         break;
       }
@@ -427,6 +427,10 @@ bool vm_is_direct_eval_form_call (void);
 
 ecma_value_t vm_get_backtrace (uint32_t max_depth);
 
+#if JERRY_VM_INLINE_CACHE
+void vm_inline_cache_invalidate (void);
+#endif /* JERRY_VM_INLINE_CACHE */
+
 /**
  * @}
  * @}
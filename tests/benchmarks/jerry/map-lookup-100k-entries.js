@@ -0,0 +1,40 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Note: the largest map needs a build with a bigger heap
+// (e.g. --cpointer-32bit=on --mem-heap=8192).
+
+var lookups = 200000;
+var sizes = [1000, 10000, 100000];
+
+for (var s = 0; s < sizes.length; s++)
+{
+  var size = sizes[s];
+  var map = new Map();
+
+  for (var i = 0; i < size; i++)
+  {
+    map.set("session" + i, i);
+  }
+
+  var start = Date.now();
+  var sum = 0;
+
+  for (var i = 0; i < lookups; i++)
+  {
+    sum += map.get("session" + (i % size));
+  }
+
+  print("size: " + size + ", lookups: " + lookups + ", time: " + (Date.now() - start) + "ms");
+}
@@ -0,0 +1,38 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function Point (x, y, z) {
+  this.x = x;
+  this.y = y;
+  this.z = z;
+  this.sum = 0;
+}
+
+var points = [];
+
+for (var i = 0; i < 2000; i++) {
+  points.push (new Point (i, i + 1, i + 2));
+}
+
+var sum = 0;
+
+for (var round = 0; round < 150; round++) {
+  for (var i = 0; i < points.length; i++) {
+    var p = points[i];
+    sum += p.x + p.y + p.z;
+    p.sum = sum;
+  }
+}
+
+assert (points[0].sum > 0);
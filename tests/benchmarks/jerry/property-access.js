@@ -0,0 +1,45 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var state = { total: 0, count: 0, min: 0, max: 0 };
+var config = { step: 3, limit: 1000000, scale: 2 };
+
+function Counter () {
+  this.value = 0;
+  this.calls = 0;
+}
+
+Counter.prototype.add = function (v) {
+  this.value = this.value + v;
+  this.calls = this.calls + 1;
+};
+
+var counter = new Counter ();
+
+for (var i = 0; i < config.limit; i += config.step) {
+  state.total = state.total + i * config.scale;
+  state.count = state.count + 1;
+
+  if (i < state.min) {
+    state.min = i;
+  }
+
+  if (i > state.max) {
+    state.max = i;
+  }
+
+  counter.add (state.count);
+}
+
+assert (state.count === counter.calls);
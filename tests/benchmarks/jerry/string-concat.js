@@ -0,0 +1,28 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var levels = ["DEBUG", "INFO", "WARN", "ERROR"];
+var total = 0;
+
+for (var round = 0; round < 10; round++) {
+  var log = "";
+
+  for (var i = 0; i < 2000; i++) {
+    log += "[" + levels[i % 4] + "] request " + i + " served in " + (i % 97) + " ms\n";
+  }
+
+  total += log.length;
+}
+
+assert (log.charAt (0) === "[");
@@ -0,0 +1,76 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function churn ()
+{
+  var list = null;
+
+  for (var i = 0; i < 2000; i++)
+  {
+    list = { next: (i % 100 == 0) ? null : list, value: [i, i + 1] };
+  }
+}
+
+function make_closure ()
+{
+  var captured = null;
+
+  return {
+    get: function () { return captured; },
+    set: function (value) { captured = value; }
+  };
+}
+
+/* The holders are promoted to the old generation by the collections below. */
+var holder = {};
+var proto_holder = {};
+var closure = make_closure ();
+var array_holder = [];
+
+churn ();
+gc ();
+churn ();
+
+/* Store young objects into the old holders. */
+holder.young = { value: "property" };
+Object.setPrototypeOf (proto_holder, { value: "prototype" });
+closure.set ({ value: "closure" });
+array_holder[0] = { value: "array" };
+
+/* Trigger several minor collections while the young objects are only reachable from old objects. */
+for (var i = 0; i < 10; i++)
+{
+  churn ();
+}
+
+assert (holder.young.value === "property");
+assert (Object.getPrototypeOf (proto_holder).value === "prototype");
+assert (proto_holder.value === "prototype");
+assert (closure.get ().value === "closure");
+assert (array_holder[0].value === "array");
+
+/* Replace the young objects and collect again. */
+for (var i = 0; i < 10; i++)
+{
+  holder.young = { value: i };
+  Object.setPrototypeOf (proto_holder, { value: i });
+  closure.set ({ value: i });
+  array_holder[0] = { value: i };
+  churn ();
+}
+
+assert (holder.young.value === 9);
+assert (proto_holder.value === 9);
+assert (closure.get ().value === 9);
+assert (array_holder[0].value === 9);
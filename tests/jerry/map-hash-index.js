@@ -0,0 +1,129 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Large containers use a hash index for their lookups. */
+var m = new Map();
+var count = 500;
+
+for (var i = 0; i < count; i++) {
+  m.set(i, "int" + i);
+  m.set("str" + i, i);
+  m.set(i + 0.5, -i);
+}
+
+assert(m.size === count * 3);
+
+for (var i = 0; i < count; i++) {
+  assert(m.get(i) === "int" + i);
+  assert(m.get("st" + "r" + i) === i);
+  assert(m.get(i + 0.5) === -i);
+}
+
+assert(!m.has(count));
+assert(!m.has("str" + count));
+assert(!m.has(-0.5));
+
+/* -0, NaN, large integers and BigInts */
+m.set(-0, "zero");
+assert(m.get(0) === "zero");
+assert(m.get(-0) === "zero");
+m.set(NaN, "nan");
+assert(m.get(0 / 0) === "nan");
+m.set(Math.pow(2, 40), "big");
+assert(m.get(Math.pow(2, 20) * Math.pow(2, 20)) === "big");
+m.set(123456789012345678901234567890n, "bigint");
+assert(m.get(123456789012345678901234567890n) === "bigint");
+m.set(0n, "bigint zero");
+assert(m.get(0n) === "bigint zero");
+
+/* Deleting and re-adding keys */
+for (var i = 0; i < count; i += 2) {
+  assert(m.delete(i));
+  assert(!m.delete(i));
+}
+
+for (var i = 0; i < count; i++) {
+  assert(m.has(i) === (i % 2 === 1));
+}
+
+m.set(0, "readded");
+assert(m.get(0) === "readded");
+
+/* Iteration order is insertion order and survives deletion during iteration */
+var s = new Set();
+for (var i = 0; i < count; i++) {
+  s.add(i);
+}
+
+var expected = 0;
+s.forEach(function (value) {
+  assert(value === expected);
+  s.delete(value + 1);
+  expected += 2;
+});
+assert(expected === count);
+assert(s.size === count / 2);
+
+var keys = [];
+for (var key of s) {
+  keys.push(key);
+}
+assert(keys.length === count / 2);
+assert(keys[0] === 0 && keys[1] === 2 && keys[keys.length - 1] === count - 2);
+
+s.clear();
+assert(s.size === 0);
+assert(!s.has(0));
+for (var i = 0; i < count; i++) {
+  s.add("x" + i);
+}
+assert(s.size === count);
+assert(s.has("x" + (count - 1)));
+
+/* Object keys */
+var objects = [];
+var wm = new WeakMap();
+var ws = new WeakSet();
+var om = new Map();
+
+for (var i = 0; i < count; i++) {
+  var o = { id: i };
+  objects.push(o);
+  wm.set(o, i);
+  ws.add(o);
+  om.set(o, i);
+}
+
+for (var i = 0; i < count; i++) {
+  assert(wm.get(objects[i]) === i);
+  assert(ws.has(objects[i]));
+  assert(om.get(objects[i]) === i);
+}
+
+assert(!wm.has({}));
+assert(!ws.has({}));
+
+for (var i = 0; i < count; i += 2) {
+  assert(wm.delete(objects[i]));
+  assert(ws.delete(objects[i]));
+  objects[i] = null;
+}
+
+gc();
+
+for (var i = 1; i < count; i += 2) {
+  assert(wm.get(objects[i]) === i);
+  assert(ws.has(objects[i]));
+}
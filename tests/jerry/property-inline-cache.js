@@ -0,0 +1,203 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Property accesses repeated from the same byte code must observe every change of the property. */
+
+function get (o) {
+  return o.value;
+}
+
+function set (o, v) {
+  o.value = v;
+}
+
+var obj = { value: 1 };
+
+for (var i = 0; i < 4; i++) {
+  assert (get (obj) === 1);
+}
+
+set (obj, 2);
+set (obj, 3);
+assert (get (obj) === 3);
+
+/* Delete and recreate. */
+delete obj.value;
+assert (get (obj) === undefined);
+set (obj, 4);
+set (obj, 5);
+assert (get (obj) === 5);
+
+/* Non-writable properties. */
+Object.defineProperty (obj, "value", { writable: false });
+set (obj, 6);
+assert (get (obj) === 5);
+
+/* Frozen objects. */
+var frozen = { value: 7 };
+set (frozen, 8);
+set (frozen, 9);
+Object.freeze (frozen);
+set (frozen, 10);
+assert (get (frozen) === 9);
+assert ((function () { "use strict"; try { frozen.value = 11; } catch (e) { return e instanceof TypeError; } }) ());
+
+/* Data property converted to accessor. */
+var acc = { value: 12 };
+assert (get (acc) === 12);
+assert (get (acc) === 12);
+var stored;
+Object.defineProperty (acc, "value", { get: function () { return 13; }, set: function (v) { stored = v; } });
+assert (get (acc) === 13);
+set (acc, 14);
+assert (stored === 14);
+assert (get (acc) === 13);
+
+/* Shadowing a prototype property. */
+var proto = { value: 15 };
+var derived = Object.create (proto);
+assert (get (derived) === 15);
+assert (get (derived) === 15);
+set (derived, 16);
+assert (get (derived) === 16);
+assert (get (proto) === 15);
+
+/* Objects freed by the garbage collector. */
+for (var i = 0; i < 100; i++) {
+  var tmp = { value: i };
+  set (tmp, i + 1);
+  assert (get (tmp) === i + 1);
+  tmp = null;
+  gc ();
+}
+
+/* Many objects and property names. */
+var objects = [];
+for (var i = 0; i < 64; i++) {
+  var o = {};
+  o["p" + i] = i;
+  o.value = -i;
+  objects.push (o);
+}
+
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < objects.length; i++) {
+    assert (get (objects[i]) === -i - round);
+    set (objects[i], -i - round - 1);
+    assert (objects[i]["p" + i] === i);
+  }
+}
+
+/* Setters and getters on non-cacheable objects. */
+var arr = [1, 2, 3];
+for (var i = 0; i < 3; i++) {
+  arr.value = i;
+  assert (get (arr) === i);
+}
+arr.length = 1;
+assert (arr.length === 1);
+
+function argsTest (a) {
+  for (var i = 0; i < 3; i++) {
+    arguments[0] = i;
+    assert (a === i);
+    assert (arguments[0] === i);
+  }
+}
+argsTest (0);
+
+/* Objects with the same property layout share the cached position. */
+function Point (x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+function getX (p) {
+  return p.x;
+}
+
+function setY (p, v) {
+  p.y = v;
+}
+
+var points = [];
+for (var i = 0; i < 32; i++) {
+  points.push (new Point (i, -i));
+}
+
+for (var i = 0; i < points.length; i++) {
+  assert (getX (points[i]) === i);
+  setY (points[i], i * 2);
+  assert (points[i].y === i * 2);
+}
+
+/* Different layouts at the same byte code. */
+var layouts = [
+  { x: 1 },
+  { y: 0, x: 2 },
+  { a: 0, b: 0, c: 0, x: 3 },
+  Object.create ({ x: 4 }),
+  { get x () { return 5; } },
+  { x: 6, y: 0 },
+];
+
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < layouts.length; i++) {
+    assert (getX (layouts[i]) === i + 1);
+  }
+}
+
+/* Same position, but the name was deleted and redefined elsewhere. */
+var p1 = new Point (7, 8);
+var p2 = new Point (9, 10);
+assert (getX (p1) === 7);
+delete p2.x;
+p2.z = 11;
+assert (getX (p2) === undefined);
+p2.x = 12;
+assert (getX (p2) === 12);
+assert (getX (p1) === 7);
+
+/* A computed key may be freed after its access was cached, and the next key can reuse its address. */
+var computed = { ab: 1, cd: 2 };
+
+function computed_get (a, b) {
+  return computed[a + b];
+}
+
+function computed_set (a, b, v) {
+  computed[a + b] = v;
+}
+
+assert (computed_get ("a", "b") === 1);
+assert (computed_get ("c", "d") === 2);
+
+computed_set ("a", "b", 10);
+computed_set ("c", "d", 20);
+assert (computed.ab === 10);
+assert (computed.cd === 20);
+
+/* The same computed key reuse through objects with the same layout. */
+var layout1 = { ab: 1, cd: 2 };
+var layout2 = { ab: 3, cd: 4 };
+
+function layout_get (o, a, b) {
+  return o[a + b];
+}
+
+assert (layout_get (layout1, "a", "b") === 1);
+assert (layout_get (layout2, "c", "d") === 4);
+assert (layout_get (layout2, "a", "b") === 3);
+assert (layout_get (layout1, "c", "d") === 2);
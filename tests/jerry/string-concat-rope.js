@@ -0,0 +1,118 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Long strings built by repeated concatenation must behave like flat strings. */
+
+function repeat (str, count) {
+  var result = "";
+  for (var i = 0; i < count; i++) {
+    result += str;
+  }
+  return result;
+}
+
+var chunk = "0123456789abcdef";
+var long_str = repeat (chunk, 200);
+
+assert (long_str.length === 3200);
+assert (long_str === chunk.repeat (200));
+assert (long_str.charAt (0) === "0");
+assert (long_str.charAt (3199) === "f");
+assert (long_str.charCodeAt (1601) === 49);
+assert (long_str.indexOf ("f0") === 15);
+assert (long_str.lastIndexOf ("ef01") === 3182);
+assert (long_str.substring (3190) === "6789abcdef");
+assert (long_str.slice (16, 32) === chunk);
+
+/* Equality between two ropes and between a rope and a flat string. */
+var other_str = repeat (chunk, 200);
+assert (long_str === other_str);
+assert (long_str == other_str);
+assert (long_str !== other_str + "x");
+assert (repeat ("ab", 800) !== repeat ("ba", 800));
+assert (repeat ("a", 2000) < repeat ("a", 2000) + "a");
+assert (!(repeat ("b", 2000) < repeat ("a", 2000)));
+
+/* Strings sharing a common prefix. */
+var prefix = repeat ("p", 1200);
+var left = prefix + "left";
+var right = prefix + "right";
+assert (left.length === 1204);
+assert (right.length === 1205);
+assert (left.slice (-4) === "left");
+assert (right.slice (-5) === "right");
+assert (prefix.length === 1200);
+assert (left !== right);
+
+/* Appending long strings to each other and prepending. */
+var doubled = long_str + other_str;
+assert (doubled.length === 6400);
+assert (doubled.slice (3195, 3205) === "bcdef01234");
+
+var prepended = "";
+for (var i = 0; i < 100; i++) {
+  prepended = i % 10 + prepended + "|";
+}
+assert (prepended.length === 200);
+assert (prepended.slice (0, 12) === "987654321098");
+assert (prepended.slice (-3) === "|||");
+
+/* Ropes as property names and map keys. */
+var obj = {};
+obj[long_str] = 1;
+assert (obj[other_str] === 1);
+assert (obj[chunk.repeat (200)] === 1);
+assert (Object.keys (obj)[0] === long_str);
+
+var key = repeat ("key", 600);
+var map = new Map ();
+map.set (key, "value");
+assert (map.get (repeat ("key", 600)) === "value");
+assert (map.get (repeat ("key", 599) + "kez") === undefined);
+
+/* Non-ASCII characters. */
+var utf8_str = repeat ("árvíztűrő ", 100);
+assert (utf8_str.length === 1000);
+assert (utf8_str.charAt (10) === "á");
+assert (utf8_str === "árvíztűrő ".repeat (100));
+assert (encodeURIComponent (utf8_str).length === 3200);
+
+var surrogate_str = repeat ("😀", 300);
+assert (surrogate_str.length === 600);
+assert (surrogate_str.codePointAt (598) === 0x1f600);
+
+/* Numbers and other primitive values are converted before concatenation. */
+var number_str = repeat ("n", 1200) + 12345 + true + null;
+assert (number_str.slice (1200) === "12345truenull");
+
+/* Deep ropes are compared, released and flattened without recursion. */
+var leaf = repeat ("c", 600);
+var deep_str = repeat (leaf, 4000);
+var deep_other_str = repeat (leaf, 4000);
+assert (deep_str.length === 2400000);
+assert (deep_str === deep_other_str);
+deep_other_str = undefined;
+deep_str = undefined;
+gc ();
+
+deep_str = repeat ("x", 100000);
+assert (deep_str.length === 100000);
+assert (deep_str.charAt (99999) === "x");
+deep_str = undefined;
+gc ();
+
+assert (JSON.stringify (repeat ("\"", 600)).length === 1202);
+assert (parseInt (repeat ("1", 1200)) === Infinity);
+assert (Number (repeat (" ", 1200) + "42") === 42);
@@ -175,6 +175,28 @@ main (void)
     jerry_value_free (test_str);
   }
 
+  /* Test jerry_string_to_buffer on a string built by repeated concatenation */
+  {
+    const jerry_char_t source[] = "var s = ''; for (var i = 0; i < 1000; i++) { s += i % 10; } s";
+    jerry_value_t test_str = jerry_eval (source, sizeof (source) - 1, JERRY_PARSE_NO_OPTS);
+
+    TEST_ASSERT (jerry_value_is_string (test_str));
+    TEST_ASSERT (jerry_string_length (test_str) == 1000);
+    TEST_ASSERT (jerry_string_size (test_str, JERRY_ENCODING_CESU8) == 1000);
+
+    char result_string[1000];
+    jerry_size_t copied =
+      jerry_string_to_buffer (test_str, JERRY_ENCODING_CESU8, (jerry_char_t *) result_string, sizeof (result_string));
+    TEST_ASSERT (copied == 1000);
+
+    for (int i = 0; i < 1000; i++)
+    {
+      TEST_ASSERT (result_string[i] == (char) ('0' + (i % 10)));
+    }
+
+    jerry_value_free (test_str);
+  }
+
   jerry_cleanup ();
 
   return 0;
@@ -0,0 +1,236 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static int free_count = 0;
+
+static void
+native_free_callback (void *native_p, /**< native pointer */
+                      jerry_object_native_info_t *info_p) /**< native info */
+{
+  (void) native_p;
+  (void) info_p;
+  free_count++;
+} /* native_free_callback */
+
+static const jerry_object_native_info_t native_info = {
+  .free_cb = native_free_callback,
+  .number_of_references = 0,
+  .offset_of_references = 0,
+};
+
+static jerry_value_t
+create_tracked_object (void)
+{
+  jerry_value_t object_value = jerry_object ();
+  jerry_object_set_native_ptr (object_value, &native_info, NULL);
+  return object_value;
+} /* create_tracked_object */
+
+static void
+set_global_property (const char *name_p, /**< property name */
+                     jerry_value_t value) /**< property value */
+{
+  jerry_value_t global_value = jerry_current_realm ();
+  jerry_value_t result = jerry_object_set_sz (global_value, name_p, value);
+  TEST_ASSERT (jerry_value_is_true (result));
+  jerry_value_free (result);
+  jerry_value_free (global_value);
+} /* set_global_property */
+
+static void
+run_script (const char *source_p) /**< script source */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_exception (result));
+  jerry_value_free (result);
+} /* run_script */
+
+static void
+complete_gc_cycle (void)
+{
+  while (!jerry_heap_gc_step (16))
+  {
+  }
+} /* complete_gc_cycle */
+
+/**
+ * Scripts which move a tracked function between heap references that bypass the value copy.
+ */
+typedef struct
+{
+  const char *setup_p; /**< stores the tracked function, and clears the global reference */
+  const char *move_p; /**< moves the tracked function to another holder */
+  const char *cleanup_p; /**< clears every reference */
+} barrier_scenario_t;
+
+static const barrier_scenario_t barrier_scenarios[] = {
+  /* Prototypes. */
+  { "var holder = Object.create (tracked); tracked = undefined",
+    "holder = Object.create (Object.getPrototypeOf (holder))",
+    "holder = undefined" },
+  /* Outer environments and function scopes. */
+  { "var getter = (function (v) { return function () { return v } }) (tracked); tracked = undefined",
+    "getter = (function (g) { var v = g (); return function () { return v } }) (getter)",
+    "getter = undefined" },
+  /* Bound function targets. */
+  { "var bound = tracked.bind (null); tracked = undefined", "bound = bound.bind (null)", "bound = undefined" },
+  /* Accessor getter and setter pairs. */
+  { "var accessor1 = {}, accessor2 = {};"
+    "Object.defineProperty (accessor1, 'x', { get: tracked, set: tracked, configurable: true });"
+    "tracked = undefined",
+    "var from = accessor1.hasOwnProperty ('x') ? accessor1 : accessor2;"
+    "var to = from === accessor1 ? accessor2 : accessor1;"
+    "var desc = Object.getOwnPropertyDescriptor (from, 'x');"
+    "Object.defineProperty (to, 'x', { get: desc.get, set: desc.set, configurable: true });"
+    "delete from.x; desc = undefined",
+    "accessor1 = accessor2 = from = to = undefined" },
+  /* Promise reactions, which are copied when the reaction list grows (the list is not grown forever). */
+  { "var promise = new Promise (function () {}), reactions = 0; promise.then (tracked); tracked = undefined",
+    "if (++reactions < 64) { promise.then (function () {}) }",
+    "promise = undefined" },
+  /* Suspended generator frames. */
+  { "var gen = (function* (v) { while (true) { var w = v; v = undefined; yield; v = w; } }) (tracked);"
+    "gen.next (); tracked = undefined",
+    "gen.next ()",
+    "gen = undefined" },
+};
+
+/**
+ * Container buffers.
+ */
+static const barrier_scenario_t container_scenario = {
+  "var map1 = new Map ([[1, tracked]]), map2 = new Map (); tracked = undefined",
+  "var from = map1.has (1) ? map1 : map2, to = map1.has (1) ? map2 : map1; to.set (1, from.get (1)); from.delete (1)",
+  "map1 = map2 = from = to = undefined"
+};
+
+static void
+run_barrier_scenario (const barrier_scenario_t *scenario_p) /**< scenario */
+{
+  int expected_free_count = free_count;
+
+  run_script ("var tracked = function () {}");
+
+  jerry_value_t global_value = jerry_current_realm ();
+  jerry_value_t tracked_value = jerry_object_get_sz (global_value, "tracked");
+  jerry_object_set_native_ptr (tracked_value, &native_info, NULL);
+  jerry_value_free (tracked_value);
+  jerry_value_free (global_value);
+
+  run_script (scenario_p->setup_p);
+
+  int steps = 0;
+
+  do
+  {
+    run_script (scenario_p->move_p);
+    steps++;
+  } while (!jerry_heap_gc_step (1));
+
+  TEST_ASSERT (steps > 1);
+  TEST_ASSERT (free_count == expected_free_count);
+
+  complete_gc_cycle ();
+  TEST_ASSERT (free_count == expected_free_count);
+
+  run_script (scenario_p->cleanup_p);
+  complete_gc_cycle ();
+  complete_gc_cycle ();
+  TEST_ASSERT (free_count == expected_free_count + 1);
+} /* run_barrier_scenario */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Objects referenced by the application survive, unreachable ones are freed. */
+  jerry_value_t object_value = create_tracked_object ();
+  complete_gc_cycle ();
+  TEST_ASSERT (free_count == 0);
+
+  jerry_value_free (object_value);
+  complete_gc_cycle ();
+  TEST_ASSERT (free_count == 1);
+
+  /* Objects moved around by scripts between the steps are not lost. */
+  object_value = create_tracked_object ();
+  set_global_property ("tracked", object_value);
+  jerry_value_free (object_value);
+  run_script ("var holder1 = { value: tracked }; var holder2 = {}; tracked = undefined");
+
+  int steps = 0;
+
+  do
+  {
+    run_script ("if (holder1.value) { holder2.value = holder1.value; delete holder1.value }"
+                "else { holder1.value = holder2.value; delete holder2.value }");
+    steps++;
+  } while (!jerry_heap_gc_step (1));
+
+  TEST_ASSERT (steps > 1);
+  TEST_ASSERT (free_count == 1);
+
+  complete_gc_cycle ();
+  TEST_ASSERT (free_count == 1);
+
+  run_script ("holder1 = undefined; holder2 = undefined");
+  complete_gc_cycle ();
+  TEST_ASSERT (free_count == 2);
+
+  /* Objects allocated during a cycle are kept alive until the next cycle. */
+  jerry_heap_gc_step (1);
+  object_value = create_tracked_object ();
+  jerry_value_free (object_value);
+  complete_gc_cycle ();
+  TEST_ASSERT (free_count == 2);
+  complete_gc_cycle ();
+  TEST_ASSERT (free_count == 3);
+
+  /* A full garbage collection cancels the pending cycle. */
+  object_value = create_tracked_object ();
+  jerry_value_free (object_value);
+  jerry_heap_gc_step (1);
+  jerry_heap_gc (JERRY_GC_PRESSURE_HIGH);
+  TEST_ASSERT (free_count == 4);
+
+  /* References stored by the engine directly, without copying a value, are seen by the marker. */
+  for (size_t i = 0; i < sizeof (barrier_scenarios) / sizeof (barrier_scenarios[0]); i++)
+  {
+    run_barrier_scenario (barrier_scenarios + i);
+  }
+
+  if (jerry_feature_enabled (JERRY_FEATURE_MAP))
+  {
+    run_barrier_scenario (&container_scenario);
+  }
+
+  /* Pending cycles are cancelled by the cleanup. */
+  int expected_free_count = free_count + 1;
+  object_value = create_tracked_object ();
+  jerry_heap_gc_step (1);
+  jerry_value_free (object_value);
+
+  jerry_cleanup ();
+  TEST_ASSERT (free_count == expected_free_count);
+
+  return 0;
+} /* main */
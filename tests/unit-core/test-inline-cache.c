@@ -0,0 +1,89 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "jcontext.h"
+#include "test-common.h"
+
+#if JERRY_VM_INLINE_CACHE
+
+static jerry_value_t
+get_global_property (const char *name_p) /**< property name */
+{
+  jerry_value_t global_value = jerry_current_realm ();
+  jerry_value_t result = jerry_object_get_sz (global_value, name_p);
+  TEST_ASSERT (!jerry_value_is_exception (result));
+  jerry_value_free (global_value);
+  return result;
+} /* get_global_property */
+
+static double
+call_function (jerry_value_t function_value, /**< function */
+               jerry_value_t argument_value) /**< argument */
+{
+  jerry_value_t result = jerry_call (function_value, jerry_undefined (), &argument_value, 1);
+  TEST_ASSERT (jerry_value_is_number (result));
+
+  double number = jerry_value_as_number (result);
+  jerry_value_free (result);
+  return number;
+} /* call_function */
+
+#endif /* JERRY_VM_INLINE_CACHE */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+#if JERRY_VM_INLINE_CACHE
+  const char *source_p = ("function Point (x, y) { this.x = x; this.y = y }\n"
+                          "function getY (p) { return p.y }\n"
+                          "var a = new Point (1, 2);\n"
+                          "var b = new Point (3, 4);\n");
+
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_exception (result));
+  jerry_value_free (result);
+
+  jerry_value_t function_value = get_global_property ("getY");
+  jerry_value_t a_value = get_global_property ("a");
+  jerry_value_t b_value = get_global_property ("b");
+
+  /* The first access fills the entry of the byte code. */
+  TEST_ASSERT (call_function (function_value, a_value) == 2);
+
+  static vm_inline_cache_entry_t entries[VM_INLINE_CACHE_SIZE];
+  memcpy (entries, JERRY_CONTEXT (vm_inline_cache), sizeof (entries));
+
+  /* An object with the same layout but different values is served by the same entry. */
+  TEST_ASSERT (call_function (function_value, b_value) == 4);
+  TEST_ASSERT (memcmp (entries, JERRY_CONTEXT (vm_inline_cache), sizeof (entries)) == 0);
+
+  TEST_ASSERT (call_function (function_value, a_value) == 2);
+  TEST_ASSERT (call_function (function_value, b_value) == 4);
+  TEST_ASSERT (memcmp (entries, JERRY_CONTEXT (vm_inline_cache), sizeof (entries)) == 0);
+
+  jerry_value_free (b_value);
+  jerry_value_free (a_value);
+  jerry_value_free (function_value);
+#endif /* JERRY_VM_INLINE_CACHE */
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -162,6 +162,8 @@ def get_arguments():
                          help='enable VM execution stop callback (%(choices)s)')
     coregrp.add_argument('--vm-throw', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable VM throw callback (%(choices)s)')
+    coregrp.add_argument('--vm-computed-goto', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable computed goto dispatch in the VM (%(choices)s)')
 
     maingrp = parser.add_argument_group('jerry-main options')
     maingrp.add_argument('--link-map', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -232,6 +234,7 @@ def generate_build_options(arguments):
     build_options_append('JERRY_VALGRIND', arguments.valgrind)
     build_options_append('JERRY_VM_HALT', arguments.vm_exec_stop)
     build_options_append('JERRY_VM_THROW', arguments.vm_throw)
+    build_options_append('JERRY_VM_COMPUTED_GOTO', arguments.vm_computed_goto)
 
     if arguments.gc_mark_limit is not None:
         build_options.append(f'-DJERRY_GC_MARK_LIMIT={arguments.gc_mark_limit}')
@@ -74,6 +74,9 @@ JERRY_TESTS_OPTIONS = [
     Options('jerry_tests-external_context',
             OPTIONS_COMMON + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT
             + ['--external-context=on']),
+    Options('jerry_tests-gc_generational',
+            OPTIONS_COMMON + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT
+            + ['--compile-flag=-DJERRY_GC_GENERATIONAL=1']),
 ]
 
 # Test options for test262